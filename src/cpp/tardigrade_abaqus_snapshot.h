@@ -0,0 +1,620 @@
+/**
+  ******************************************************************************
+  * \file tardigrade_abaqus_snapshot.h
+  ******************************************************************************
+  * Asynchronous per-increment snapshots of UMAT stress and state variables.
+  * Solver threads hand their STRESS and STATEV arrays to a bounded lock-free
+  * queue and a background thread writes them to a columnar binary file.
+  ******************************************************************************
+  */
+
+#ifndef TARDIGRADE_ABAQUS_SNAPSHOT_H
+#define TARDIGRADE_ABAQUS_SNAPSHOT_H
+
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstring>
+#include<exception>
+#include<fstream>
+#include<memory>
+#include<stdexcept>
+#include<string>
+#include<thread>
+#include<vector>
+
+#include<tardigrade_abaqus_tools.h>
+
+namespace tardigradeAbaqusTools{
+
+    //! The magic bytes at the start of every snapshot file
+    const char SNAPSHOT_MAGIC[ 8 ] = { 'T', 'A', 'T', 'S', 'N', 'A', 'P', '1' };
+
+    //! The snapshot file header flag for XOR-delta compressed value columns
+    const std::uint32_t SNAPSHOT_COMPRESSED = 1;
+
+    enum class SnapshotBackPressure{
+        BLOCK, //!< Wait for a free queue slot when the queue is full
+        DROP   //!< Discard the snapshot when the queue is full
+    };
+
+    struct SnapshotStatistics{
+        /*!
+         * Snapshot writer counters. The submit time is the total time the solver threads spent in
+         * ``SnapshotWriter::submit`` and is the writer's overhead on the solver.
+         */
+        std::uint64_t submitted = 0;        //!< The number of snapshots accepted by the queue
+        std::uint64_t written = 0;          //!< The number of snapshots written to the file
+        std::uint64_t dropped = 0;          //!< The number of snapshots discarded by the DROP policy
+        std::uint64_t blocked = 0;          //!< The number of submits that waited for a free queue slot
+        std::uint64_t bytes = 0;            //!< The number of bytes written to the file
+        std::uint64_t submit_nanoseconds = 0; //!< The total solver thread time spent in submit
+
+        double meanSubmitNanoseconds( ) const{
+            /*!
+             * Get the mean solver thread time of a submit call
+             */
+            const std::uint64_t calls = submitted + dropped;
+            return ( calls == 0 ) ? 0. : static_cast< double >( submit_nanoseconds ) / calls;
+        }
+    };
+
+    inline void encodeSnapshotColumn( const double *values, const std::size_t &length, std::vector< unsigned char > &bytes ){
+        /*!
+         * Append a column of values to a byte buffer with XOR-delta, leading zero byte compression. Each value is
+         * XORed with the previous value of the column and stored as a count of leading zero bytes followed by the
+         * remaining bytes, most significant first. Repeated and slowly varying values, e.g. unused state variables or
+         * the stress of a converged point, shrink to one or a few bytes. Values are reproduced bit for bit, including
+         * NaN and Inf.
+         *
+         * \param *values: The column values
+         * \param &length: The number of values
+         * \param &bytes: The byte buffer to append to
+         */
+        std::uint64_t previous = 0;
+        for ( std::size_t index = 0; index < length; index++ ){
+            std::uint64_t current;
+            std::memcpy( &current, values + index, sizeof( current ) );
+            const std::uint64_t delta = current ^ previous;
+            previous = current;
+            unsigned int leading_zero_bytes = 0;
+            while ( ( leading_zero_bytes < 8 ) && ( ( delta >> ( 56 - 8 * leading_zero_bytes ) ) == 0 ) ){
+                leading_zero_bytes++;
+            }
+            bytes.push_back( static_cast< unsigned char >( leading_zero_bytes ) );
+            for ( int byte = 7 - leading_zero_bytes; byte >= 0; byte-- ){
+                bytes.push_back( static_cast< unsigned char >( delta >> ( 8 * byte ) ) );
+            }
+        }
+    }
+
+    inline std::size_t decodeSnapshotColumn( const unsigned char *bytes, const std::size_t &size, double *values,
+                                             const std::size_t &length ){
+        /*!
+         * Decode a column written by ``tardigradeAbaqusTools::encodeSnapshotColumn``
+         *
+         * \param *bytes: The encoded column
+         * \param &size: The number of available encoded bytes
+         * \param *values: The decoded column values
+         * \param &length: The number of values to decode
+         * \returns consumed: The number of bytes decoded
+         */
+        std::uint64_t previous = 0;
+        std::size_t position = 0;
+        for ( std::size_t index = 0; index < length; index++ ){
+            if ( ( position >= size ) || ( bytes[ position ] > 8 ) || ( position + 9 - bytes[ position ] > size ) ){
+                throw std::runtime_error( "The compressed snapshot column is corrupt" );
+            }
+            const unsigned int leading_zero_bytes = bytes[ position++ ];
+            std::uint64_t delta = 0;
+            for ( unsigned int byte = leading_zero_bytes; byte < 8; byte++ ){
+                delta = ( delta << 8 ) | bytes[ position++ ];
+            }
+            previous ^= delta;
+            std::memcpy( values + index, &previous, sizeof( previous ) );
+        }
+        return position;
+    }
+
+    class SnapshotWriter{
+        /*!
+         * Asynchronous writer of per-increment UMAT stress and state variable snapshots.
+         *
+         * ``submit`` copies a point's STRESS and STATEV into a preallocated slot of a bounded lock-free
+         * multi-producer queue and returns. It never allocates, locks, or touches the file, so the solver threads
+         * only pay for the copy. A background thread drains the queue in batches and writes each batch
+         * column by column, i.e. all NOEL values, then all NPT values, ..., then all values of each stress and state
+         * variable component, so the file can be read one field at a time for restart diagnostics and training
+         * data. The queue capacity bounds the memory and the number of snapshots in flight. When the queue is full
+         * the back-pressure policy either waits for the writer or drops the snapshot.
+         *
+         * One writer serves one material with fixed NTENS and NSTATV, e.g. a function local static in the UMAT
+         *
+         * \code{.cpp}
+         * static tardigradeAbaqusTools::SnapshotWriter writer( "snapshots.bin", NTENS, NSTATV );
+         * writer.submit( NOEL, NPT, JSTEP[ 0 ], KINC, TIME[ 1 ] + DTIME, STRESS, STATEV );
+         * \endcode
+         *
+         * File layout, native byte order:
+         *
+         * - header: the 8 byte ``SNAPSHOT_MAGIC``, then uint32 NTENS, NSTATV, and flags
+         * - batches: uint32 record count n, int32 NOEL[n], NPT[n], KSTEP[n], KINC[n], double time[n], then NTENS stress
+         *   columns and NSTATV state variable columns of n doubles. With ``SNAPSHOT_COMPRESSED`` each double column
+         *   is a uint32 byte count followed by ``tardigradeAbaqusTools::encodeSnapshotColumn`` bytes.
+         */
+
+        public:
+
+            SnapshotWriter( const std::string &filename, const int &NTENS, const int &NSTATV,
+                            const std::size_t &queue_capacity = 4096, const std::size_t &batch_size = 256,
+                            const SnapshotBackPressure &policy = SnapshotBackPressure::BLOCK, const bool &compress = false )
+                : _ntens( NTENS ), _nstatv( NSTATV ), _width( NTENS + NSTATV ), _batch_size( batch_size ),
+                  _policy( policy ), _compress( compress ){
+                /*!
+                 * Open the snapshot file, allocate the queue slots and batch buffers, and start the writer thread
+                 *
+                 * \param &filename: The snapshot file name. An existing file is overwritten.
+                 * \param &NTENS: The number of stress components of every snapshot
+                 * \param &NSTATV: The number of state variables of every snapshot
+                 * \param &queue_capacity: The minimum number of queued snapshots. Rounded up to a power of two.
+                 * \param &batch_size: The maximum number of snapshots written per batch
+                 * \param &policy: The back-pressure policy when the queue is full
+                 * \param &compress: Flag for XOR-delta compression of the stress and state variable columns
+                 */
+
+                if ( ( NTENS < 0 ) || ( NSTATV < 0 ) || ( queue_capacity == 0 ) || ( batch_size == 0 ) ){
+                    throw std::invalid_argument( "The snapshot NTENS and NSTATV must be non-negative and the queue capacity and batch size positive" );
+                }
+
+                _capacity = 1;
+                while ( _capacity < queue_capacity ){
+                    _capacity <<= 1;
+                }
+                _mask = _capacity - 1;
+
+                _cells.reset( new Cell[ _capacity ] );
+                for ( std::size_t index = 0; index < _capacity; index++ ){
+                    _cells[ index ].sequence.store( index, std::memory_order_relaxed );
+                }
+                _slot_integers.resize( 4 * _capacity );
+                _slot_times.resize( _capacity );
+                _slot_values.resize( _width * _capacity );
+
+                _batch_integers.resize( 4 * _batch_size );
+                _batch_integer_columns.resize( 4 * _batch_size );
+                _batch_times.resize( _batch_size );
+                _batch_values.resize( _width * _batch_size );
+                _batch_columns.resize( _width * _batch_size );
+                _encoded.reserve( 9 * _batch_size );
+
+                _file.open( filename, std::ios::binary | std::ios::trunc );
+                if ( !_file ){
+                    throw std::runtime_error( "Unable to open the snapshot file " + filename );
+                }
+                const std::uint32_t header[ 3 ] = { static_cast< std::uint32_t >( NTENS ), static_cast< std::uint32_t >( NSTATV ),
+                                                    _compress ? SNAPSHOT_COMPRESSED : 0 };
+                write( SNAPSHOT_MAGIC, sizeof( SNAPSHOT_MAGIC ) );
+                write( header, sizeof( header ) );
+
+                _thread = std::thread( &SnapshotWriter::run, this );
+            }
+
+            ~SnapshotWriter( ){
+                /*!
+                 * Write the queued snapshots and stop the writer thread. Writer thread errors are discarded. Call
+                 * ``close`` to have them thrown.
+                 */
+                stop( );
+            }
+
+            SnapshotWriter( const SnapshotWriter& ) = delete;
+
+            SnapshotWriter &operator=( const SnapshotWriter& ) = delete;
+
+            bool submit( const int &NOEL, const int &NPT, const int &KSTEP, const int &KINC, const double &time,
+                         const double *STRESS, const double *STATEV ){
+                /*!
+                 * Queue a snapshot of a point. Safe to call concurrently from every solver thread. Throws the first
+                 * writer thread error, e.g. a failed write, so a solver does not keep producing snapshots that are
+                 * never written.
+                 *
+                 * \param &NOEL: The element number
+                 * \param &NPT: The integration point number
+                 * \param &KSTEP: The step number
+                 * \param &KINC: The increment number
+                 * \param &time: The snapshot time, e.g. the total time at the end of the increment
+                 * \param *STRESS: The Abaqus STRESS array of length NTENS
+                 * \param *STATEV: The Abaqus STATEV array of length NSTATV.
+                 * \returns queued: False if the snapshot was dropped by the DROP policy
+                 */
+
+                rethrow( );
+
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+
+                std::size_t position;
+                bool waited = false;
+                while ( !claim( position ) ){
+                    if ( _policy == SnapshotBackPressure::DROP ){
+                        _dropped.fetch_add( 1, std::memory_order_relaxed );
+                        addSubmitTime( start );
+                        return false;
+                    }
+                    rethrow( );
+                    waited = true;
+                    std::this_thread::yield( );
+                }
+
+                const std::size_t slot = position & _mask;
+                _slot_integers[ 4 * slot + 0 ] = NOEL;
+                _slot_integers[ 4 * slot + 1 ] = NPT;
+                _slot_integers[ 4 * slot + 2 ] = KSTEP;
+                _slot_integers[ 4 * slot + 3 ] = KINC;
+                _slot_times[ slot ] = time;
+                std::memcpy( _slot_values.data( ) + _width * slot, STRESS, _ntens * sizeof( double ) );
+                std::memcpy( _slot_values.data( ) + _width * slot + _ntens, STATEV, _nstatv * sizeof( double ) );
+                _cells[ slot ].sequence.store( position + 1, std::memory_order_release );
+
+                _submitted.fetch_add( 1, std::memory_order_relaxed );
+                if ( waited ){
+                    _blocked.fetch_add( 1, std::memory_order_relaxed );
+                }
+                addSubmitTime( start );
+                return true;
+            }
+
+            void flush( ){
+                /*!
+                 * Wait until every snapshot queued before the call is written and flushed to the file. Throws the
+                 * first writer thread error, e.g. a failed write or flush.
+                 */
+                const std::uint64_t target = _enqueue_position.load( std::memory_order_acquire );
+                while ( _flushed.load( std::memory_order_acquire ) < target ){
+                    rethrow( );
+                    std::this_thread::sleep_for( std::chrono::microseconds( 50 ) );
+                }
+                rethrow( );
+            }
+
+            void close( ){
+                /*!
+                 * Write the queued snapshots, stop the writer thread, and close the file. Throws the first writer
+                 * thread error.
+                 */
+                stop( );
+                rethrow( );
+            }
+
+            SnapshotStatistics statistics( ) const{
+                /*!
+                 * Get the writer counters
+                 */
+                SnapshotStatistics statistics;
+                statistics.submitted = _submitted.load( std::memory_order_relaxed );
+                statistics.written = _written.load( std::memory_order_relaxed );
+                statistics.dropped = _dropped.load( std::memory_order_relaxed );
+                statistics.blocked = _blocked.load( std::memory_order_relaxed );
+                statistics.bytes = _bytes.load( std::memory_order_relaxed );
+                statistics.submit_nanoseconds = _submit_nanoseconds.load( std::memory_order_relaxed );
+                return statistics;
+            }
+
+            std::size_t capacity( ) const{
+                /*!
+                 * Get the number of queue slots
+                 */
+                return _capacity;
+            }
+
+        private:
+
+            struct alignas( 64 ) Cell{
+                std::atomic< std::size_t > sequence;
+            };
+
+            const std::size_t _ntens;
+            const std::size_t _nstatv;
+            const std::size_t _width;
+            const std::size_t _batch_size;
+            const SnapshotBackPressure _policy;
+            const bool _compress;
+
+            std::size_t _capacity;
+            std::size_t _mask;
+            std::unique_ptr< Cell[] > _cells;
+            std::vector< int > _slot_integers;
+            std::vector< double > _slot_times;
+            std::vector< double > _slot_values;
+
+            alignas( 64 ) std::atomic< std::size_t > _enqueue_position{ 0 };
+            alignas( 64 ) std::atomic< std::size_t > _dequeue_position{ 0 };
+
+            alignas( 64 ) std::atomic< std::uint64_t > _submitted{ 0 };
+            std::atomic< std::uint64_t > _dropped{ 0 };
+            std::atomic< std::uint64_t > _blocked{ 0 };
+            std::atomic< std::uint64_t > _submit_nanoseconds{ 0 };
+
+            alignas( 64 ) std::atomic< std::uint64_t > _written{ 0 };
+            std::atomic< std::uint64_t > _flushed{ 0 };
+            std::atomic< std::uint64_t > _bytes{ 0 };
+            std::atomic< bool > _stop{ false };
+            std::atomic< bool > _failed{ false };
+            std::exception_ptr _error;
+
+            std::vector< int > _batch_integers;
+            std::vector< int > _batch_integer_columns;
+            std::vector< double > _batch_times;
+            std::vector< double > _batch_values;
+            std::vector< double > _batch_columns;
+            std::vector< unsigned char > _encoded;
+            std::ofstream _file;
+            std::thread _thread;
+
+            bool claim( std::size_t &position ){
+                /*!
+                 * Claim the next free queue slot
+                 *
+                 * \param &position: The claimed queue position
+                 * \returns claimed: False if the queue is full
+                 */
+                position = _enqueue_position.load( std::memory_order_relaxed );
+                while ( true ){
+                    const std::size_t sequence = _cells[ position & _mask ].sequence.load( std::memory_order_acquire );
+                    const std::ptrdiff_t difference = static_cast< std::ptrdiff_t >( sequence ) - static_cast< std::ptrdiff_t >( position );
+                    if ( difference == 0 ){
+                        if ( _enqueue_position.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ){
+                            return true;
+                        }
+                    }
+                    else if ( difference < 0 ){
+                        return false;
+                    }
+                    else{
+                        position = _enqueue_position.load( std::memory_order_relaxed );
+                    }
+                }
+            }
+
+            bool pop( const std::size_t &row ){
+                /*!
+                 * Move the oldest queued snapshot into a batch row. Only called by the writer thread.
+                 *
+                 * \param &row: The batch row
+                 * \returns popped: False if the queue is empty
+                 */
+                const std::size_t position = _dequeue_position.load( std::memory_order_relaxed );
+                const std::size_t slot = position & _mask;
+                if ( _cells[ slot ].sequence.load( std::memory_order_acquire ) != position + 1 ){
+                    return false;
+                }
+                _dequeue_position.store( position + 1, std::memory_order_relaxed );
+
+                std::memcpy( _batch_integers.data( ) + 4 * row, _slot_integers.data( ) + 4 * slot, 4 * sizeof( int ) );
+                _batch_times[ row ] = _slot_times[ slot ];
+                std::memcpy( _batch_values.data( ) + _width * row, _slot_values.data( ) + _width * slot, _width * sizeof( double ) );
+                _cells[ slot ].sequence.store( position + _capacity, std::memory_order_release );
+                return true;
+            }
+
+            void run( ){
+                /*!
+                 * The writer thread loop
+                 */
+                try{
+                    while ( true ){
+                        const bool stopping = _stop.load( std::memory_order_acquire );
+                        std::size_t rows = 0;
+                        while ( ( rows < _batch_size ) && pop( rows ) ){
+                            rows++;
+                        }
+                        if ( rows > 0 ){
+                            writeBatch( rows );
+                            _written.fetch_add( rows, std::memory_order_release );
+                            continue;
+                        }
+                        const std::uint64_t written = _written.load( std::memory_order_relaxed );
+                        if ( _flushed.load( std::memory_order_relaxed ) != written ){
+                            _file.flush( );
+                            if ( !_file ){
+                                throw std::runtime_error( "Unable to flush the snapshot file" );
+                            }
+                            _flushed.store( written, std::memory_order_release );
+                        }
+                        if ( _dequeue_position.load( std::memory_order_relaxed ) != _enqueue_position.load( std::memory_order_acquire ) ){
+                            //A claimed slot is not published yet
+                            std::this_thread::yield( );
+                        }
+                        else if ( stopping ){
+                            break;
+                        }
+                        else{
+                            std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+                        }
+                    }
+                    _file.close( );
+                    if ( _file.fail( ) ){
+                        throw std::runtime_error( "Unable to close the snapshot file" );
+                    }
+                }
+                catch( ... ){
+                    _error = std::current_exception( );
+                    _failed.store( true, std::memory_order_release );
+                    //Release the solver threads waiting on a full queue or a flush
+                    _flushed.store( UINT64_MAX, std::memory_order_release );
+                    while ( !_stop.load( std::memory_order_acquire ) ){
+                        std::size_t rows = 0;
+                        while ( pop( 0 ) ){
+                            rows++;
+                        }
+                        if ( rows == 0 ){
+                            std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+                        }
+                    }
+                }
+            }
+
+            void writeBatch( const std::size_t &rows ){
+                /*!
+                 * Write a batch of snapshots column by column
+                 *
+                 * \param &rows: The number of snapshots in the batch
+                 */
+                const std::uint32_t count = static_cast< std::uint32_t >( rows );
+                write( &count, sizeof( count ) );
+
+                //Transpose the row-major batch into columns
+                rowToColumnMajor( _batch_integer_columns.data( ), _batch_integers.data( ), static_cast< int >( rows ), 4 );
+                write( _batch_integer_columns.data( ), 4 * rows * sizeof( int ) );
+                write( _batch_times.data( ), rows * sizeof( double ) );
+                rowToColumnMajor( _batch_columns.data( ), _batch_values.data( ), static_cast< int >( rows ),
+                                  static_cast< int >( _width ) );
+
+                for ( std::size_t column = 0; column < _width; column++ ){
+                    const double *values = _batch_columns.data( ) + column * rows;
+                    if ( _compress ){
+                        _encoded.clear( );
+                        encodeSnapshotColumn( values, rows, _encoded );
+                        const std::uint32_t size = static_cast< std::uint32_t >( _encoded.size( ) );
+                        write( &size, sizeof( size ) );
+                        write( _encoded.data( ), _encoded.size( ) );
+                    }
+                    else{
+                        write( values, rows * sizeof( double ) );
+                    }
+                }
+                if ( !_file ){
+                    throw std::runtime_error( "Unable to write the snapshot file" );
+                }
+            }
+
+            void write( const void *data, const std::size_t &size ){
+                /*!
+                 * Write bytes to the snapshot file
+                 *
+                 * \param *data: The bytes to write
+                 * \param &size: The number of bytes
+                 */
+                _file.write( static_cast< const char* >( data ), size );
+                _bytes.fetch_add( size, std::memory_order_relaxed );
+            }
+
+            void addSubmitTime( const std::chrono::steady_clock::time_point &start ){
+                /*!
+                 * Add the elapsed time of a submit call to the submit time counter
+                 *
+                 * \param &start: The start time of the submit call
+                 */
+                const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now( ) - start;
+                _submit_nanoseconds.fetch_add( elapsed.count( ), std::memory_order_relaxed );
+            }
+
+            void stop( ){
+                /*!
+                 * Stop and join the writer thread. The writer thread drains the queue, including slots claimed
+                 * before the stop but published after it, before it exits.
+                 */
+                if ( _thread.joinable( ) ){
+                    _stop.store( true, std::memory_order_release );
+                    _thread.join( );
+                }
+            }
+
+            void rethrow( ){
+                /*!
+                 * Throw the writer thread error
+                 */
+                if ( _failed.load( std::memory_order_acquire ) ){
+                    std::rethrow_exception( _error );
+                }
+            }
+
+    };
+
+    struct SnapshotColumns{
+        /*!
+         * The contents of a snapshot file with one vector per column
+         */
+        int NTENS = 0;                               //!< The number of stress components
+        int NSTATV = 0;                              //!< The number of state variables
+        std::vector< int > NOEL;                     //!< The element numbers
+        std::vector< int > NPT;                      //!< The integration point numbers
+        std::vector< int > KSTEP;                    //!< The step numbers
+        std::vector< int > KINC;                     //!< The increment numbers
+        std::vector< double > time;                  //!< The snapshot times
+        std::vector< std::vector< double > > stress; //!< The NTENS stress component columns
+        std::vector< std::vector< double > > statev; //!< The NSTATV state variable columns
+    };
+
+    inline SnapshotColumns readSnapshotFile( const std::string &filename ){
+        /*!
+         * Read a snapshot file written by ``tardigradeAbaqusTools::SnapshotWriter``
+         *
+         * \param &filename: The snapshot file name
+         * \returns columns: The snapshot columns in file order
+         */
+
+        std::ifstream file( filename, std::ios::binary );
+        if ( !file ){
+            throw std::runtime_error( "Unable to open the snapshot file " + filename );
+        }
+        auto read = [ & ]( void *data, const std::size_t &size ){
+            file.read( static_cast< char* >( data ), size );
+            if ( static_cast< std::size_t >( file.gcount( ) ) != size ){
+                throw std::runtime_error( "The snapshot file " + filename + " is truncated" );
+            }
+        };
+
+        char magic[ sizeof( SNAPSHOT_MAGIC ) ];
+        std::uint32_t header[ 3 ];
+        read( magic, sizeof( magic ) );
+        if ( std::memcmp( magic, SNAPSHOT_MAGIC, sizeof( magic ) ) != 0 ){
+            throw std::runtime_error( filename + " is not a snapshot file" );
+        }
+        read( header, sizeof( header ) );
+
+        SnapshotColumns columns;
+        columns.NTENS = header[ 0 ];
+        columns.NSTATV = header[ 1 ];
+        const bool compressed = ( header[ 2 ] & SNAPSHOT_COMPRESSED ) != 0;
+        columns.stress.resize( columns.NTENS );
+        columns.statev.resize( columns.NSTATV );
+
+        std::vector< unsigned char > encoded;
+        std::uint32_t count;
+        while ( file.read( reinterpret_cast< char* >( &count ), sizeof( count ) ) ){
+            for ( std::vector< int > *integers : { &columns.NOEL, &columns.NPT, &columns.KSTEP, &columns.KINC } ){
+                integers->resize( integers->size( ) + count );
+                read( integers->data( ) + integers->size( ) - count, count * sizeof( int ) );
+            }
+            columns.time.resize( columns.time.size( ) + count );
+            read( columns.time.data( ) + columns.time.size( ) - count, count * sizeof( double ) );
+
+            for ( std::vector< std::vector< double > > *fields : { &columns.stress, &columns.statev } ){
+                for ( std::vector< double > &column : *fields ){
+                    column.resize( column.size( ) + count );
+                    double *values = column.data( ) + column.size( ) - count;
+                    if ( compressed ){
+                        std::uint32_t size;
+                        read( &size, sizeof( size ) );
+                        encoded.resize( size );
+                        read( encoded.data( ), size );
+                        if ( decodeSnapshotColumn( encoded.data( ), size, values, count ) != size ){
+                            throw std::runtime_error( "The compressed snapshot column is corrupt" );
+                        }
+                    }
+                    else{
+                        read( values, count * sizeof( double ) );
+                    }
+                }
+            }
+        }
+        if ( file.gcount( ) != 0 ){
+            throw std::runtime_error( "The snapshot file " + filename + " is truncated" );
+        }
+
+        return columns;
+    }
+
+}
+
+#endif
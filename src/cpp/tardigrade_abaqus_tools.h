@@ -12,11 +12,257 @@
 
 #include<iostream>
 #include<vector>
+#include<array>
+#include<algorithm>
+#include<cmath>
+#include<stdexcept>
+#include<map>
+#include<memory>
+#include<mutex>
+#include<shared_mutex>
+#include<string>
+#include<string_view>
+#include<new>
+#include<cstddef>
+#include<cstdint>
+#include<type_traits>
 #include<string.h>
 #include<stdio.h>
 
+//! The default capacity in bytes of each thread's conversion workspace
+#ifndef TARDIGRADE_ABAQUS_TOOLS_WORKSPACE_CAPACITY
+    #define TARDIGRADE_ABAQUS_TOOLS_WORKSPACE_CAPACITY 262144
+#endif
+
+//! The number of points the rows of tardigradeAbaqusTools::SoABuffer are padded to a multiple of
+#ifndef TARDIGRADE_ABAQUS_TOOLS_SOA_LANES
+    #define TARDIGRADE_ABAQUS_TOOLS_SOA_LANES 8
+#endif
+
+//! The non-aliasing pointer qualifier of the vectorized block kernels
+#ifndef TARDIGRADE_ABAQUS_TOOLS_RESTRICT
+    #if defined( __GNUC__ ) || defined( __clang__ ) || defined( _MSC_VER )
+        #define TARDIGRADE_ABAQUS_TOOLS_RESTRICT __restrict
+    #else
+        #define TARDIGRADE_ABAQUS_TOOLS_RESTRICT
+    #endif
+#endif
+
+//! Marks the point loop of a vectorized block kernel as free of loop-carried dependences. Each point only reads and
+//! writes its own lane of every component, so the in-place kernels are safe as well.
+#ifndef TARDIGRADE_ABAQUS_TOOLS_IVDEP
+    #if defined( __clang__ )
+        #define TARDIGRADE_ABAQUS_TOOLS_IVDEP _Pragma( "clang loop vectorize(assume_safety)" )
+    #elif defined( __GNUC__ )
+        #define TARDIGRADE_ABAQUS_TOOLS_IVDEP _Pragma( "GCC ivdep" )
+    #elif defined( _MSC_VER )
+        #define TARDIGRADE_ABAQUS_TOOLS_IVDEP __pragma( loop( ivdep ) )
+    #else
+        #define TARDIGRADE_ABAQUS_TOOLS_IVDEP
+    #endif
+#endif
+
+/*!
+ * Build mode checks. Define TARDIGRADE_ABAQUS_TOOLS_CHECKED to validate the NDI/NSHR ranges and container sizes of the
+ * conversion functions. Additionally define TARDIGRADE_ABAQUS_TOOLS_CHECKED_FINITE to scan their inputs and outputs for
+ * NaN/Inf values. The definitions are set by the consumer, e.g. for Debug configurations only, and must be the same in
+ * every translation unit of a program. Failed checks are logged to std::cerr with the element and integration point
+ * context from tardigradeAbaqusTools::CheckContextScope and throw. The exception must be caught inside the UMAT or
+ * VUMAT; it must not unwind into the Abaqus Fortran frames. Without the definitions the checks compile to nothing.
+ *
+ * Two checks are always compiled because they guard more than the hot path. The ``std::vector`` overloads of
+ * ``rowToColumnMajor`` throw std::length_error on a size mismatch, as they did before the checked builds, before
+ * writing into the caller's Fortran array. The VUMAT block dispatch throws std::out_of_range for ndir or nshr without a
+ * kernel instantiation; it runs once per block, outside the point loop. Use the pointer overload of
+ * ``rowToColumnMajor`` for an unchecked conversion.
+ */
+#ifdef TARDIGRADE_ABAQUS_TOOLS_CHECKED
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK( condition, exception, message ) \
+        do{ if ( !( condition ) ){ tardigradeAbaqusTools::checkFailure< exception >( __func__, message ); } }while( false )
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR ) \
+        tardigradeAbaqusTools::checkNTENS( __func__, NDI, NSHR )
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_SHAPE( matrix, rows, columns, message ) \
+        tardigradeAbaqusTools::checkShape( __func__, message, matrix, rows, columns )
+#else
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK( condition, exception, message ) ( void )0
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR ) ( void )0
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_SHAPE( matrix, rows, columns, message ) ( void )0
+#endif
+#if defined( TARDIGRADE_ABAQUS_TOOLS_CHECKED ) && defined( TARDIGRADE_ABAQUS_TOOLS_CHECKED_FINITE )
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( values, name ) \
+        tardigradeAbaqusTools::checkFinite( __func__, name, values )
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( values, length, name ) \
+        tardigradeAbaqusTools::checkFinite( __func__, name, values, length )
+#else
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( values, name ) ( void )0
+    #define TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( values, length, name ) ( void )0
+#endif
+
 namespace tardigradeAbaqusTools{
 
+    struct CheckContext{
+        /*!
+         * The Abaqus call context reported by failed checks
+         */
+        int NOEL = 0; //!< The element number. Zero when unknown.
+        int NPT = 0;  //!< The integration point number. Zero when unknown.
+    };
+
+    inline CheckContext &checkContext( ){
+        /*!
+         * Get the calling thread's check context
+         */
+        thread_local CheckContext context;
+        return context;
+    }
+
+    class CheckContextScope{
+        /*!
+         * Set the element and integration point reported by failed checks for the lifetime of the scope. Declare one at
+         * the top of a UMAT. Does nothing unless TARDIGRADE_ABAQUS_TOOLS_CHECKED is defined.
+         */
+
+        public:
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_CHECKED
+            CheckContextScope( const int &NOEL, const int &NPT ) : _previous( checkContext( ) ){
+                checkContext( ).NOEL = NOEL;
+                checkContext( ).NPT = NPT;
+            }
+
+            ~CheckContextScope( ){
+                checkContext( ) = _previous;
+            }
+#else
+            CheckContextScope( const int&, const int& ){ }
+#endif
+
+            CheckContextScope( const CheckContextScope& ) = delete;
+
+            CheckContextScope &operator=( const CheckContextScope& ) = delete;
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_CHECKED
+        private:
+
+            CheckContext _previous;
+#endif
+
+    };
+
+    template< class E >
+    [[noreturn]] inline void checkFailure( const char *function, const std::string &message ){
+        /*!
+         * Log a failed check with the calling thread's check context and throw
+         *
+         * \param *function: The name of the function that failed the check
+         * \param &message: The failure description
+         */
+        std::string report = std::string( function ) + ": " + message;
+        const CheckContext &context = checkContext( );
+        if ( ( context.NOEL != 0 ) || ( context.NPT != 0 ) ){
+            report += " (element " + std::to_string( context.NOEL ) + ", integration point " + std::to_string( context.NPT ) + ")";
+        }
+        std::cerr << "tardigrade_abaqus_tools check failed in " << report << std::endl;
+        throw E( report );
+    }
+
+    inline void checkNTENS( const char *function, const int &NDI, const int &NSHR ){
+        /*!
+         * Check that NDI is in [1, 3] and NSHR is in [0, 3]
+         *
+         * \param *function: The name of the calling function
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+        if ( ( NDI < 1 ) || ( NDI > 3 ) || ( NSHR < 0 ) || ( NSHR > 3 ) ){
+            checkFailure< std::out_of_range >( function, "NDI = " + std::to_string( NDI ) + " must be in [1, 3] and NSHR = "
+                                                         + std::to_string( NSHR ) + " must be in [0, 3]" );
+        }
+    }
+
+    template< typename T, class A, class B >
+    inline void checkShape( const char *function, const char *message, const std::vector< std::vector< T, A >, B > &matrix,
+                            const int &rows, const int &columns ){
+        /*!
+         * Check the number of rows and the width of every row of a vector of vectors
+         *
+         * \param *function: The name of the calling function
+         * \param *message: The failure description
+         * \param &matrix: The vector of vectors to check
+         * \param &rows: The expected number of rows
+         * \param &columns: The expected width of every row
+         */
+        if ( static_cast< int >( matrix.size( ) ) != rows ){
+            checkFailure< std::length_error >( function, message );
+        }
+        for ( const std::vector< T, A > &row : matrix ){
+            if ( static_cast< int >( row.size( ) ) != columns ){
+                checkFailure< std::length_error >( function, message );
+            }
+        }
+    }
+
+    template< typename T >
+    inline void checkFinite( const char *function, const char *name, const T *values, const int &length ){
+        /*!
+         * Check that every value of an array is finite
+         *
+         * \param *function: The name of the calling function
+         * \param *name: The name of the checked array
+         * \param *values: The array to check
+         * \param &length: The array length
+         */
+        for ( int index = 0; index < length; index++ ){
+            if ( !std::isfinite( values[ index ] ) ){
+                checkFailure< std::domain_error >( function, std::string( name ) + "[" + std::to_string( index )
+                                                             + "] is not finite" );
+            }
+        }
+    }
+
+    template< typename T, class A >
+    inline void checkFinite( const char *function, const char *name, const std::vector< T, A > &values ){
+        /*!
+         * Check that every value of a vector is finite
+         *
+         * \param *function: The name of the calling function
+         * \param *name: The name of the checked vector
+         * \param &values: The vector to check
+         */
+        checkFinite( function, name, values.data( ), static_cast< int >( values.size( ) ) );
+    }
+
+    template< typename T, class A, class B >
+    inline void checkFinite( const char *function, const char *name, const std::vector< std::vector< T, A >, B > &values ){
+        /*!
+         * Check that every value of a vector of vectors is finite
+         *
+         * \param *function: The name of the calling function
+         * \param *name: The name of the checked vector of vectors
+         * \param &values: The vector of vectors to check
+         */
+        for ( const std::vector< T, A > &row : values ){
+            checkFinite( function, name, row.data( ), static_cast< int >( row.size( ) ) );
+        }
+    }
+
+    inline int trimmedFortranStringLength( int stringLength, const char* fString ){
+        /*!
+         * Get the length of a Fortran string without the trailing blank padding
+         *
+         * \param stringLength: The length of the Fortran string.
+         * \param *fString: The pointer to the start of the Fortran string.
+         * \returns stringLen: The length of the string without trailing white space
+         */
+        int stringLen = stringLength;
+        for ( int k1 = stringLength - 1; k1 >= 0; k1-- )
+        {
+            if ( fString[ k1 ] != ' ' ) break;
+            stringLen = k1;
+        }
+        return stringLen;
+    }
+
     inline char *FtoCString( int stringLength, const char* fString ){
         /*!
          * Converts a Fortran string to C-string. Trims trailing white space during processing.
@@ -29,45 +275,488 @@ namespace tardigradeAbaqusTools{
          * \param stringLength: The length of the Fortran string.
          * \param *fString: The pointer to the start of the Fortran string.
          */
-        int stringLen = stringLength;
-        for ( int k1 = stringLength - 1; k1 >= 0; k1-- )
-    	{
-    	    if ( fString[ k1 ] != ' ' ) break;
-    	    stringLen = k1;
-    	}
+        int stringLen = trimmedFortranStringLength( stringLength, fString );
         char* cString  = new char [ stringLen + 1 ];
         memcpy ( cString, fString, stringLen );
         cString[ stringLen ] = '\0';
         return cString;
     }
 
+    template< class Parameters >
+    class MaterialParameterCache{
+        /*!
+         * A thread-safe cache of parsed material parameters keyed on the material name and the contents of PROPS.
+         *
+         * The Parameters type is a user declared struct with a constructor
+         *
+         *     Parameters( const double *PROPS, const int &NPROPS )
+         *
+         * that copies, validates and derives every quantity the material kernel needs, e.g. elastic moduli. Invalid
+         * parameters should throw from the constructor; nothing is cached in that case.
+         *
+         * The first call with a new material name and PROPS contents parses PROPS once. Later calls hash PROPS, take a
+         * shared lock and return a read-only reference without parsing or allocating. The cache key uses the PROPS
+         * contents rather than the pointer because Abaqus may reuse the same storage when parameters change between
+         * steps; changed contents produce a new entry. Entries are never evicted, so references remain valid until
+         * ``clear`` is called.
+         */
+
+        public:
+
+            const Parameters &get( const char *CMNAME, const int &CMNAME_length, const double *PROPS, const int &NPROPS ){
+                /*!
+                 * Get the parsed parameters of a material, parsing PROPS on the first call
+                 *
+                 * \param *CMNAME: The blank padded Fortran material name
+                 * \param &CMNAME_length: The length of the Fortran material name
+                 * \param *PROPS: The material properties
+                 * \param &NPROPS: The number of material properties
+                 * \returns parameters: The cached parameters
+                 */
+
+                const KeyView key = { hashFortranArray( PROPS, NPROPS ), NPROPS,
+                                      std::string_view( CMNAME, trimmedFortranStringLength( CMNAME_length, CMNAME ) ),
+                                      PROPS };
+
+                {
+                    std::shared_lock< std::shared_mutex > lock( _mutex );
+                    typename std::map< Key, Parameters, Compare >::const_iterator entry = _entries.find( key );
+                    if ( entry != _entries.end( ) ){
+                        return entry->second;
+                    }
+                }
+
+                //Parse outside of the lock so a slow or throwing parse does not block readers
+                Parameters parameters( PROPS, NPROPS );
+
+                std::unique_lock< std::shared_mutex > lock( _mutex );
+                return _entries.emplace( Key{ key.hash, key.nprops, std::string( key.name ),
+                                              std::vector< double >( PROPS, PROPS + NPROPS ) },
+                                         std::move( parameters ) ).first->second;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * Get the number of cached parameter sets
+                 */
+                std::shared_lock< std::shared_mutex > lock( _mutex );
+                return _entries.size( );
+            }
+
+            void clear( ){
+                /*!
+                 * Remove every cached parameter set. Invalidates every reference returned by ``get``.
+                 */
+                std::unique_lock< std::shared_mutex > lock( _mutex );
+                _entries.clear( );
+            }
+
+            static std::uint64_t hashFortranArray( const double *array, const int &length ){
+                /*!
+                 * Compute the 64 bit FNV-1a hash of the bytes of an array
+                 *
+                 * \param *array: The array to hash
+                 * \param &length: The number of array entries
+                 */
+                const unsigned char *bytes = reinterpret_cast< const unsigned char* >( array );
+                std::uint64_t hash = 14695981039346656037ULL;
+                for ( std::size_t index = 0; index < length * sizeof( double ); index++ ){
+                    hash = ( hash ^ bytes[ index ] ) * 1099511628211ULL;
+                }
+                return hash;
+            }
+
+        private:
+
+            struct Key{
+                std::uint64_t hash;
+                int nprops;
+                std::string name;
+                std::vector< double > props;
+            };
+
+            struct KeyView{
+                std::uint64_t hash;
+                int nprops;
+                std::string_view name;
+                const double *props;
+            };
+
+            struct Compare{
+                /*!
+                 * Order keys by hash, number of properties, name and finally the exact property bytes so a hash
+                 * collision can never return the parameters of a different PROPS array
+                 */
+
+                typedef void is_transparent;
+
+                template< class L, class R >
+                bool operator()( const L &left, const R &right ) const{
+                    if ( left.hash != right.hash ){
+                        return left.hash < right.hash;
+                    }
+                    if ( left.nprops != right.nprops ){
+                        return left.nprops < right.nprops;
+                    }
+                    const int name_order = std::string_view( left.name ).compare( std::string_view( right.name ) );
+                    if ( name_order != 0 ){
+                        return name_order < 0;
+                    }
+                    return memcmp( data( left.props ), data( right.props ), left.nprops * sizeof( double ) ) < 0;
+                }
+
+                static const double *data( const std::vector< double > &props ){ return props.data( ); }
+
+                static const double *data( const double *props ){ return props; }
+            };
+
+            std::map< Key, Parameters, Compare > _entries;
+
+            mutable std::shared_mutex _mutex;
+
+    };
+
+    class ThreadWorkspace{
+        /*!
+         * A monotonic scratch buffer owned by a single thread for the temporaries of the conversion functions.
+         *
+         * Abaqus calls UMATs and VUMATs concurrently in thread-parallel runs. Temporaries drawn from a thread's
+         * workspace never touch shared allocator state and, because the buffer is allocated and first touched by the
+         * owning thread, the Linux first-touch policy places its pages on the NUMA node the thread runs on.
+         *
+         * Allocations are released all at once with ``release`` or ``reset``. Use ``tardigradeAbaqusTools::WorkspaceScope``
+         * to reset the workspace at the end of every subroutine call.
+         */
+
+        public:
+
+            explicit ThreadWorkspace( const std::size_t capacity ) : _capacity( capacity ), _offset( 0 ), _overflows( 0 ),
+                                                                     _depth( 0 ){
+                /*!
+                 * Allocate and first touch the workspace buffer from the calling thread
+                 *
+                 * \param capacity: The workspace capacity in bytes
+                 */
+                _buffer = static_cast< unsigned char* >( ::operator new( _capacity, std::align_val_t( alignment ) ) );
+                memset( _buffer, 0, _capacity );
+            }
+
+            ~ThreadWorkspace( ){
+                ::operator delete( _buffer, std::align_val_t( alignment ) );
+            }
+
+            ThreadWorkspace( const ThreadWorkspace& ) = delete;
+
+            ThreadWorkspace &operator=( const ThreadWorkspace& ) = delete;
+
+            void *allocate( const std::size_t bytes, const std::size_t align ){
+                /*!
+                 * Allocate from the workspace
+                 *
+                 * \param bytes: The number of bytes to allocate
+                 * \param align: The required alignment. Must be a power of two no larger than the buffer alignment.
+                 * \returns pointer: The allocated memory or nullptr if the workspace is exhausted
+                 */
+                const std::size_t offset = ( _offset + align - 1 ) & ~( align - 1 );
+                if ( ( align > alignment ) || ( offset + bytes > _capacity ) ){
+                    _overflows++;
+                    return nullptr;
+                }
+                _offset = offset + bytes;
+                return _buffer + offset;
+            }
+
+            bool owns( const void *pointer ) const{
+                /*!
+                 * Check if a pointer was allocated from the workspace
+                 *
+                 * \param *pointer: The pointer to check
+                 */
+                const unsigned char *address = static_cast< const unsigned char* >( pointer );
+                return ( address >= _buffer ) && ( address < _buffer + _capacity );
+            }
+
+            std::size_t mark( ) const{
+                /*!
+                 * Get the current allocation offset for a later ``release``
+                 */
+                return _offset;
+            }
+
+            void release( const std::size_t mark ){
+                /*!
+                 * Release every allocation made since the mark was taken
+                 *
+                 * \param mark: A previous value of ``mark``
+                 */
+                _offset = mark;
+            }
+
+            void reset( ){
+                /*!
+                 * Release every allocation
+                 */
+                _offset = 0;
+            }
+
+            std::size_t depth( ) const{
+                /*!
+                 * Get the number of open ``tardigradeAbaqusTools::WorkspaceScope`` objects of the workspace
+                 */
+                return _depth;
+            }
+
+            std::size_t used( ) const{
+                /*!
+                 * Get the number of bytes currently allocated
+                 */
+                return _offset;
+            }
+
+            std::size_t capacity( ) const{
+                /*!
+                 * Get the workspace capacity in bytes
+                 */
+                return _capacity;
+            }
+
+            std::size_t overflows( ) const{
+                /*!
+                 * Get the number of allocations that did not fit in the workspace and fell back to the heap
+                 */
+                return _overflows;
+            }
+
+            const void *data( ) const{
+                /*!
+                 * Get the start of the workspace buffer
+                 */
+                return _buffer;
+            }
+
+            //! The alignment of the workspace buffer. A cache line.
+            static const std::size_t alignment = 64;
+
+        private:
+
+            unsigned char *_buffer;
+
+            std::size_t _capacity;
+
+            std::size_t _offset;
+
+            std::size_t _overflows;
+
+            std::size_t _depth;
+
+            friend class WorkspaceScope;
+
+    };
+
+    inline ThreadWorkspace &threadWorkspace( ){
+        /*!
+         * Get the calling thread's conversion workspace. The workspace is created on the first call from each thread
+         * with a capacity of ``TARDIGRADE_ABAQUS_TOOLS_WORKSPACE_CAPACITY`` bytes.
+         */
+        thread_local ThreadWorkspace workspace( TARDIGRADE_ABAQUS_TOOLS_WORKSPACE_CAPACITY );
+        return workspace;
+    }
+
+    class WorkspaceScope{
+        /*!
+         * Release every allocation made from the calling thread's workspace during the lifetime of the scope. Declare
+         * one at the top of a UMAT or VUMAT so the workspace is reset every call.
+         *
+         * Workspace backed containers must not outlive the scope they were created in. Containers created before the
+         * scope opened may still grow inside it: their allocators only draw from the workspace while no inner scope is
+         * open and otherwise fall back to the heap, so their storage is never reclaimed by an inner scope.
+         */
+
+        public:
+
+            WorkspaceScope( ) : _workspace( threadWorkspace( ) ), _mark( _workspace.mark( ) ){
+                _workspace._depth++;
+            }
+
+            ~WorkspaceScope( ){
+                _workspace._depth--;
+                _workspace.release( _mark );
+            }
+
+            WorkspaceScope( const WorkspaceScope& ) = delete;
+
+            WorkspaceScope &operator=( const WorkspaceScope& ) = delete;
+
+        private:
+
+            ThreadWorkspace &_workspace;
+
+            std::size_t _mark;
+
+    };
+
     template< typename T >
-    inline std::vector< std::vector< T > > columnToRowMajor( const T *column_major,  const int &height, const int &width ){
+    class WorkspaceAllocator{
+        /*!
+         * Standard library allocator drawing from the workspace of the thread that constructed it. Allocations that do
+         * not fit in the workspace fall back to the heap. Deallocation of workspace memory is a no-op; the memory is
+         * recovered when the enclosing ``tardigradeAbaqusTools::WorkspaceScope`` ends.
+         *
+         * The allocator remembers its workspace and the scope depth it was constructed at. It only draws from the
+         * workspace at that depth, so a container that grows inside a scope opened after it was created allocates from
+         * the heap instead of memory the inner scope would reclaim. Allocators of the same workspace but different
+         * depths compare unequal, so moving a container across scopes moves its elements instead of taking over memory
+         * the inner scope reclaims.
+         *
+         * Workspace backed containers must only grow on the thread that created them. They may be destroyed on another
+         * thread while the creating thread is alive. Deallocation reads the creating thread's workspace, so the
+         * creating thread must outlive its workspace backed containers.
+         */
+
+        public:
+
+            typedef T value_type;
+
+            WorkspaceAllocator( ) noexcept : WorkspaceAllocator( threadWorkspace( ) ){ }
+
+            explicit WorkspaceAllocator( ThreadWorkspace &workspace ) noexcept : _workspace( &workspace ),
+                                                                                 _depth( workspace.depth( ) ){ }
+
+            template< typename U >
+            WorkspaceAllocator( const WorkspaceAllocator< U > &other ) noexcept : _workspace( other.workspace( ) ),
+                                                                                   _depth( other.depth( ) ){ }
+
+            T *allocate( const std::size_t n ){
+                void *pointer = nullptr;
+                if ( _workspace->depth( ) == _depth ){
+                    pointer = _workspace->allocate( n * sizeof( T ), alignof( T ) );
+                }
+                if ( !pointer ){
+                    pointer = ::operator new( n * sizeof( T ) );
+                }
+                return static_cast< T* >( pointer );
+            }
+
+            void deallocate( T *pointer, const std::size_t ) noexcept{
+                if ( !_workspace->owns( pointer ) ){
+                    ::operator delete( pointer );
+                }
+            }
+
+            ThreadWorkspace *workspace( ) const noexcept{
+                /*!
+                 * Get the workspace the allocator draws from
+                 */
+                return _workspace;
+            }
+
+            std::size_t depth( ) const noexcept{
+                /*!
+                 * Get the workspace scope depth the allocator draws from the workspace at
+                 */
+                return _depth;
+            }
+
+        private:
+
+            ThreadWorkspace *_workspace;
+
+            std::size_t _depth;
+
+    };
+
+    template< typename T, typename U >
+    inline bool operator==( const WorkspaceAllocator< T > &a, const WorkspaceAllocator< U > &b ){
+        return ( a.workspace( ) == b.workspace( ) ) && ( a.depth( ) == b.depth( ) );
+    }
+
+    template< typename T, typename U >
+    inline bool operator!=( const WorkspaceAllocator< T > &a, const WorkspaceAllocator< U > &b ){ return !( a == b ); }
+
+    //! A vector backed by the calling thread's workspace
+    template< typename T >
+    using workspace_vector = std::vector< T, WorkspaceAllocator< T > >;
+
+    //! A vector of vectors backed by the calling thread's workspace
+    template< typename T >
+    using workspace_matrix = std::vector< workspace_vector< T >, WorkspaceAllocator< workspace_vector< T > > >;
+
+    template< typename T, class A >
+    inline std::vector< std::vector< T, A >, typename std::allocator_traits< A >::template rebind_alloc< std::vector< T, A > > >
+        columnToRowMajor( const T *column_major, const int &height, const int &width, const A &allocator ){
         /*!
          * Convert column major two dimensional arrays to row major.
          *
-         * Specifically, convert pointers to Fortran column major arrays to c++ row major vector of vectors.
+         * Specifically, convert pointers to Fortran column major arrays to c++ row major vector of vectors drawn from
+         * the given allocator, e.g. ``tardigradeAbaqusTools::WorkspaceAllocator`` for a ``workspace_matrix``.
          *
          * \param *column_major: The pointer to the start of a column major array
          * \param &height: The height of the array, e.g. number of rows
          * \param &width: The width of the array, e.g. number of columns
+         * \param &allocator: The allocator of the rows. Rebound for the outer vector.
          * \return row_major: A c++ row major vector of vectors
          */
-        std::vector< std::vector< T > > row_major;
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( height >= 0 ) && ( width >= 0 ), std::length_error,
+                                       "The height and width must be non-negative" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( column_major, height * width, "column_major" );
+        typedef typename std::allocator_traits< A >::template rebind_alloc< std::vector< T, A > > B;
+        const B outer_allocator( allocator );
+        std::vector< std::vector< T, A >, B > row_major( outer_allocator );
+        row_major.reserve( height );
         int column_major_index;
         for ( int row = 0; row < height; row++ ){
-            std::vector< T > row_vector;
+            std::vector< T, A > row_vector( allocator );
+            row_vector.reserve( width );
             for ( int col = 0; col < width; col++ ){
                 column_major_index = col*height + row;
                 row_vector.push_back( *( column_major + column_major_index ) );
             }
-            row_major.push_back( row_vector );
+            row_major.push_back( std::move( row_vector ) );
         }
         return row_major;
     }
 
     template< typename T >
-    inline void rowToColumnMajor( T *column_major, const std::vector< std::vector< T > > &row_major_array,
+    inline std::vector< std::vector< T > > columnToRowMajor( const T *column_major,  const int &height, const int &width ){
+        /*!
+         * Convert column major two dimensional arrays to row major.
+         *
+         * Specifically, convert pointers to Fortran column major arrays to c++ row major vector of vectors.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         * \return row_major: A c++ row major vector of vectors
+         */
+        return columnToRowMajor( column_major, height, width, std::allocator< T >( ) );
+    }
+
+    template< typename T >
+    inline void rowToColumnMajor( T *column_major, const T *row_major, const int &height, const int &width ){
+        /*!
+         * Convert a row major two dimensional array to a column major array without validation
+         *
+         * The non-validating path of the ``std::vector`` interface for callers that own both buffers, e.g. the batch
+         * transposes of ``tardigradeAbaqusTools::SnapshotWriter``. The row major array must hold height * width values.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param *row_major: The pointer to the start of a row major array
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         */
+        int row_major_index;
+        int column_major_index;
+        for ( int row = 0; row < height; row++ ){
+            for ( int col = 0; col < width; col++ ){
+                row_major_index = row*width + col;
+                column_major_index = col*height + row;
+                column_major[column_major_index] = row_major[row_major_index];
+            }
+        }
+    }
+
+    template< typename T, class A, class B >
+    inline void rowToColumnMajor( T *column_major, const std::vector< std::vector< T, A >, B > &row_major_array,
                                   const int &height, const int &width ){
         /*!
          * Convert row major two dimensional arrays to column major
@@ -81,10 +770,11 @@ namespace tardigradeAbaqusTools{
          * \param &width: The width of the array, e.g. number of columns
          */
         const int rows = row_major_array.size();
-        const int columns = row_major_array[0].size();
-        if (rows != height || columns != width){
+        if ( ( rows != height ) || ( ( rows > 0 ) && ( static_cast< int >( row_major_array[0].size() ) != width ) ) ){
             throw std::length_error("Column major size must match row major size");
         }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_SHAPE( row_major_array, height, width, "Column major size must match row major size" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( row_major_array, "row_major_array" );
         int column_major_index;
         for ( int row = 0; row < height; row++ ){
             for ( int col = 0; col < width; col++ ){
@@ -96,8 +786,8 @@ namespace tardigradeAbaqusTools{
         return;
     }
 
-    template< typename T >
-    inline void rowToColumnMajor( T *column_major, const std::vector< T > &row_major, const int &height, const int &width ){
+    template< typename T, class A >
+    inline void rowToColumnMajor( T *column_major, const std::vector< T, A > &row_major, const int &height, const int &width ){
         /*!
          * Convert row major two dimensional arrays stored as vector to column major array
          *
@@ -112,27 +802,260 @@ namespace tardigradeAbaqusTools{
         if (length != height*width){
             throw std::length_error("Column major size must match row major size");
         }
-        int row_major_index;
-        int column_major_index;
-        for ( int row = 0; row < height; row++ ){
-            for ( int col = 0; col < width; col++ ){
-                row_major_index = row*width + col;
-                column_major_index = col*height + row;
-                column_major[column_major_index] = row_major[row_major_index];
-            }
-        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( row_major, "row_major" );
+        rowToColumnMajor( column_major, row_major.data( ), height, width );
     }
 
-    template< typename T >
-    inline std::vector< T > expandAbaqusNTENSVector( const std::vector< T > &abaqus_vector,
-                                                     const int &NDI, const int &NSHR ){
+    struct AbaqusComponentMap{
         /*!
-         * Expand stress and strain type components to full Abaqus vectors.
+         * The gather/scatter tables between a contracted Abaqus stress-type vector of length NTENS = NDI + NSHR and a
+         * full 3x3 tensor stored as a row-major vector of length 9. Generated by
+         * ``tardigradeAbaqusTools::makeAbaqusComponentMap``.
+         */
+        unsigned int ntens;                                //!< The number of stress-type components NDI + NSHR
+        std::array< unsigned int, 6 > contracted_to_tensor; //!< The row-major tensor index of each stress-type component
+        std::array< int, 9 > tensor_to_contracted;          //!< The stress-type index of each tensor component. -1 if zero
+        std::array< unsigned int, 6 > contracted_to_full;   //!< The full length 6 Abaqus vector index of each stress-type component
+    };
+
+    constexpr std::array< std::array< unsigned int, 2 >, 3 > abaqusShearComponents( const bool abaqus_standard = true ){
+        /*!
+         * The single description of the Abaqus stress-type component ordering that every component table is derived
+         * from. The direct components are always \f$ 11, 22, 33 \f$ and the shear components are
          *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
+         * Abaqus/Standard (UMAT): \f$ 12, 13, 23 \f$
          *
-         * The stress vector components for Abaqus/Standard (UMAT) are
+         * Abaqus/Explicit (VUMAT): \f$ 12, 23, 13 \f$
+         *
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns shear_components: The zero based (row, column) indices of the shear components in order.
+         */
+        if ( abaqus_standard ){
+            return { { { 0, 1 }, { 0, 2 }, { 1, 2 } } };
+        }
+        return { { { 0, 1 }, { 1, 2 }, { 0, 2 } } };
+    }
+
+    constexpr AbaqusComponentMap makeAbaqusComponentMap( const int NDI, const int NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Generate the gather/scatter tables between a contracted Abaqus stress-type vector, the full length 6 Abaqus
+         * vector, and a full row-major 3x3 tensor from ``tardigradeAbaqusTools::abaqusShearComponents``.
+         *
+         * \param NDI: The number of direct components. 0 to 3.
+         * \param NSHR: The number of shear components. 0 to 3.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns component_map: The component tables
+         */
+        const std::array< std::array< unsigned int, 2 >, 3 > shear = abaqusShearComponents( abaqus_standard );
+        AbaqusComponentMap component_map{ static_cast< unsigned int >( NDI + NSHR ),
+                                          { 0, 0, 0, 0, 0, 0 },
+                                          { -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+                                          { 0, 0, 0, 0, 0, 0 } };
+        for ( int index = 0; index < NDI; index++ ){
+            component_map.contracted_to_tensor[ index ] = 4 * index;
+            component_map.tensor_to_contracted[ 4 * index ] = index;
+            component_map.contracted_to_full[ index ] = index;
+        }
+        for ( int index = 0; index < NSHR; index++ ){
+            const unsigned int row = shear[ index ][ 0 ];
+            const unsigned int column = shear[ index ][ 1 ];
+            component_map.contracted_to_tensor[ NDI + index ] = 3 * row + column;
+            component_map.tensor_to_contracted[ 3 * row + column ] = NDI + index;
+            component_map.tensor_to_contracted[ 3 * column + row ] = NDI + index;
+            component_map.contracted_to_full[ NDI + index ] = 3 + index;
+        }
+        return component_map;
+    }
+
+    //! Every Abaqus component map indexed by [ abaqus_standard ][ NDI ][ NSHR ]
+    typedef std::array< std::array< std::array< AbaqusComponentMap, 4 >, 4 >, 2 > AbaqusComponentMapTable;
+
+    constexpr AbaqusComponentMapTable makeAbaqusComponentMapTable( ){
+        /*!
+         * Generate the component maps of both Abaqus solvers for every NDI and NSHR
+         */
+        AbaqusComponentMapTable table{ };
+        for ( int solver = 0; solver < 2; solver++ ){
+            for ( int NDI = 0; NDI < 4; NDI++ ){
+                for ( int NSHR = 0; NSHR < 4; NSHR++ ){
+                    table[ solver ][ NDI ][ NSHR ] = makeAbaqusComponentMap( NDI, NSHR, solver == 1 );
+                }
+            }
+        }
+        return table;
+    }
+
+    inline const AbaqusComponentMap &abaqusComponentMap( const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Look up the compile-time generated component map for a solver, NDI and NSHR
+         *
+         * \param &NDI: The number of direct components. 0 to 3.
+         * \param &NSHR: The number of shear components. 0 to 3.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+        static constexpr AbaqusComponentMapTable table = makeAbaqusComponentMapTable( );
+        return table[ abaqus_standard ][ NDI ][ NSHR ];
+    }
+
+    template< typename T, std::size_t N >
+    constexpr bool equalComponentOrder( const std::array< T, N > &order, const std::array< T, N > &expected ){
+        /*!
+         * Compile-time comparison of two component tables
+         */
+        for ( std::size_t index = 0; index < N; index++ ){
+            if ( order[ index ] != expected[ index ] ){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool validAbaqusComponentMapTable( const AbaqusComponentMapTable &table ){
+        /*!
+         * Check that every component map gathers and scatters consistently: each stress-type component round trips
+         * through the tensor tables and maps to the same tensor component in the full length 6 vector, symmetric
+         * tensor components share a stress-type component, and exactly NTENS upper triangle tensor components are
+         * non-zero.
+         */
+        for ( int solver = 0; solver < 2; solver++ ){
+            for ( int NDI = 0; NDI < 4; NDI++ ){
+                for ( int NSHR = 0; NSHR < 4; NSHR++ ){
+                    const AbaqusComponentMap &component_map = table[ solver ][ NDI ][ NSHR ];
+                    if ( component_map.ntens != static_cast< unsigned int >( NDI + NSHR ) ){
+                        return false;
+                    }
+                    const AbaqusComponentMap &full_map = table[ solver ][ 3 ][ 3 ];
+                    for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+                        if ( component_map.tensor_to_contracted[ component_map.contracted_to_tensor[ index ] ] != static_cast< int >( index ) ){
+                            return false;
+                        }
+                        if ( full_map.contracted_to_tensor[ component_map.contracted_to_full[ index ] ] != component_map.contracted_to_tensor[ index ] ){
+                            return false;
+                        }
+                    }
+                    unsigned int nonzero = 0;
+                    for ( unsigned int row = 0; row < 3; row++ ){
+                        for ( unsigned int column = 0; column < 3; column++ ){
+                            if ( component_map.tensor_to_contracted[ 3 * row + column ] != component_map.tensor_to_contracted[ 3 * column + row ] ){
+                                return false;
+                            }
+                            nonzero += ( column >= row ) && ( component_map.tensor_to_contracted[ 3 * row + column ] >= 0 );
+                        }
+                    }
+                    if ( nonzero != component_map.ntens ){
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    static_assert( validAbaqusComponentMapTable( makeAbaqusComponentMapTable( ) ),
+                   "The Abaqus component maps must gather and scatter consistently" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 3, 3, true ).contracted_to_tensor, { 0, 4, 8, 1, 2, 5 } ),
+                   "Abaqus/Standard stress-type order must be 11, 22, 33, 12, 13, 23" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 3, 3, false ).contracted_to_tensor, { 0, 4, 8, 1, 5, 2 } ),
+                   "Abaqus/Explicit stress-type order must be 11, 22, 33, 12, 23, 13" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 3, 3, true ).tensor_to_contracted, { 0, 3, 4, 3, 1, 5, 4, 5, 2 } ),
+                   "Abaqus/Standard tensor packing order mismatch" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 3, 3, false ).tensor_to_contracted, { 0, 3, 5, 3, 1, 4, 5, 4, 2 } ),
+                   "Abaqus/Explicit tensor packing order mismatch" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 2, 1, true ).tensor_to_contracted, { 0, 2, -1, 2, 1, -1, -1, -1, -1 } ),
+                   "Abaqus/Standard plane stress packing order mismatch" );
+    static_assert( equalComponentOrder( makeAbaqusComponentMap( 3, 1, false ).tensor_to_contracted, { 0, 3, -1, 3, 1, -1, -1, -1, 2 } ),
+                   "Abaqus/Explicit plane strain packing order mismatch" );
+
+    struct AbaqusDeformationGradientMap{
+        /*!
+         * The gather/scatter table between an Abaqus/Explicit (VUMAT) deformation gradient of length NDIR + 2 NSHR and a
+         * full 3x3 tensor stored as a row-major vector of length 9. Generated by
+         * ``tardigradeAbaqusTools::makeAbaqusDeformationGradientMap``.
+         */
+        unsigned int ncomponents;                           //!< The number of deformation gradient components NDIR + 2 NSHR
+        std::array< unsigned int, 9 > component_to_tensor;  //!< The row-major tensor index of each component
+        std::array< int, 9 > tensor_to_component;           //!< The component index of each tensor component. -1 if omitted
+    };
+
+    constexpr std::array< std::array< unsigned int, 2 >, 3 > abaqusDeformationGradientShearComponents( ){
+        /*!
+         * The single description of the Abaqus/Explicit (VUMAT) non-symmetric deformation gradient ordering. The direct
+         * components $ F_{11}, F_{22}, F_{33} $ are followed by the NSHR upper shear components
+         * $ F_{12}, F_{23}, F_{31} $ and then the NSHR lower shear components, their transposes
+         * $ F_{21}, F_{32}, F_{13} $.
+         *
+         * \returns shear_components: The zero based (row, column) indices of the upper shear components in order.
+         */
+        return { { { 0, 1 }, { 1, 2 }, { 2, 0 } } };
+    }
+
+    constexpr AbaqusDeformationGradientMap makeAbaqusDeformationGradientMap( const int NDIR, const int NSHR ){
+        /*!
+         * Generate the gather/scatter table of an Abaqus/Explicit deformation gradient from
+         * ``tardigradeAbaqusTools::abaqusDeformationGradientShearComponents``.
+         *
+         * \param NDIR: The number of direct components. 0 to 3.
+         * \param NSHR: The number of shear components. 0 to 3.
+         * \returns deformation_gradient_map: The component table
+         */
+        const std::array< std::array< unsigned int, 2 >, 3 > shear = abaqusDeformationGradientShearComponents( );
+        AbaqusDeformationGradientMap deformation_gradient_map{ static_cast< unsigned int >( NDIR + 2 * NSHR ),
+                                                               { 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+                                                               { -1, -1, -1, -1, -1, -1, -1, -1, -1 } };
+        for ( int index = 0; index < NDIR; index++ ){
+            deformation_gradient_map.component_to_tensor[ index ] = 4 * index;
+            deformation_gradient_map.tensor_to_component[ 4 * index ] = index;
+        }
+        for ( int index = 0; index < NSHR; index++ ){
+            const unsigned int row = shear[ index ][ 0 ];
+            const unsigned int column = shear[ index ][ 1 ];
+            deformation_gradient_map.component_to_tensor[ NDIR + index ] = 3 * row + column;
+            deformation_gradient_map.component_to_tensor[ NDIR + NSHR + index ] = 3 * column + row;
+            deformation_gradient_map.tensor_to_component[ 3 * row + column ] = NDIR + index;
+            deformation_gradient_map.tensor_to_component[ 3 * column + row ] = NDIR + NSHR + index;
+        }
+        return deformation_gradient_map;
+    }
+
+    inline const AbaqusDeformationGradientMap &abaqusDeformationGradientMap( const int &NDIR, const int &NSHR ){
+        /*!
+         * Look up the compile-time generated deformation gradient map for NDIR and NSHR
+         *
+         * \param &NDIR: The number of direct components. 0 to 3.
+         * \param &NSHR: The number of shear components. 0 to 3.
+         */
+        static constexpr std::array< std::array< AbaqusDeformationGradientMap, 4 >, 4 > table = [ ]( ){
+            std::array< std::array< AbaqusDeformationGradientMap, 4 >, 4 > maps{ };
+            for ( int ndir = 0; ndir < 4; ndir++ ){
+                for ( int nshr = 0; nshr < 4; nshr++ ){
+                    maps[ ndir ][ nshr ] = makeAbaqusDeformationGradientMap( ndir, nshr );
+                }
+            }
+            return maps;
+        }( );
+        return table[ NDIR ][ NSHR ];
+    }
+
+    static_assert( equalComponentOrder( makeAbaqusDeformationGradientMap( 3, 3 ).component_to_tensor, { 0, 4, 8, 1, 5, 6, 3, 7, 2 } ),
+                   "Abaqus/Explicit deformation gradient order must be 11, 22, 33, 12, 23, 31, 21, 32, 13" );
+    static_assert( equalComponentOrder( makeAbaqusDeformationGradientMap( 3, 1 ).component_to_tensor, { 0, 4, 8, 1, 3, 0, 0, 0, 0 } ),
+                   "Abaqus/Explicit two dimensional deformation gradient order must be 11, 22, 33, 12, 21" );
+    static_assert( equalComponentOrder( makeAbaqusDeformationGradientMap( 3, 3 ).tensor_to_component, { 0, 3, 8, 6, 1, 4, 5, 7, 2 } ),
+                   "Abaqus/Explicit deformation gradient unpacking order mismatch" );
+
+    template< typename T, class A >
+    inline std::vector< T, A > expandAbaqusNTENSVector( const std::vector< T, A > &abaqus_vector,
+                                                        const int &NDI, const int &NSHR ){
+        /*!
+         * Expand stress and strain type components to full Abaqus vectors.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
          *
          * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
          *
@@ -161,397 +1084,1489 @@ namespace tardigradeAbaqusTools{
          * \returns vector_expansion: c++ type vector of length 6.
          */
 
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( static_cast< int >( abaqus_vector.size( ) ) == NDI + NSHR, std::length_error,
+                                       "The Abaqus vector size must be NDI + NSHR" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( abaqus_vector, "abaqus_vector" );
+
         //Initialize expanded vector to the appropriate dimensions with zero values
-        std::vector< T > vector_expansion( 6, 0 );
+        std::vector< T, A > vector_expansion( 6, 0, abaqus_vector.get_allocator( ) );
 
-        //Unpack direct components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NDI; index++ ){
-            vector_expansion[ index ] = abaqus_vector[ index ];
+        //Unpack the stress-type components into their full vector positions
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR );
+        for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+            vector_expansion[ component_map.contracted_to_full[ index ] ] = abaqus_vector[ index ];
+        }
+
+        return vector_expansion;
+    }
+
+    template< typename T, class A >
+    inline std::vector< T, A > contractAbaqusNTENSVector( const std::vector< T, A > &full_abaqus_vector,
+                                                          const int &NDI, const int &NSHR ){
+        /*!
+         * Contract stress and strain type components from full Abaqus vectors.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         *
+         * The stress vector components for Abaqus/Explicit (VUMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
+         *
+         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
+         * engineering shear strain where
+         *
+         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
+         *
+         * for both Abaqus/Standard and Abaqus/Explicit.
+         *
+         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns vector_contraction: c++ type vector of length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( full_abaqus_vector.size( ) == 6, std::length_error,
+                                       "The full Abaqus vector size must be 6" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( full_abaqus_vector, "full_abaqus_vector" );
+
+        //Initialize contracted vector to the appropriate dimensions
+        std::vector< T, A > vector_contraction( NDI + NSHR, T( ), full_abaqus_vector.get_allocator( ) );
+
+        //Pack the non-zero stress-type components from their full vector positions
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR );
+        for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+            vector_contraction[ index ] = full_abaqus_vector[ component_map.contracted_to_full[ index ] ];
+        }
+
+        return vector_contraction;
+    }
+
+    template< typename T, class A, class B >
+    inline std::vector< std::vector < T, A >, B > contractAbaqusNTENSMatrix( const std::vector< std::vector< T, A >, B > &full_abaqus_matrix,
+                                                                             const int &NDI, const int &NSHR ){
+        /*!
+         * Contract NTENS type components from full Abaqus stress-type matrixes (6x6). ONLY APPLIES TO
+         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         *
+         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The related matrixes are
+         * therefore ordered for Abaqus/Standard (UMAT) as
+         *
+         * TODO: Update LaTeX formatting for a well aligned matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * \param &full_abaqus_matrix: a previously expanded abaqus NTENS matrix. Dimensions 6x6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns matrix_contraction: c++ type vector of vectors with square shape of size NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_SHAPE( full_abaqus_matrix, 6, 6, "The full Abaqus matrix must be 6x6" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( full_abaqus_matrix, "full_abaqus_matrix" );
+
+        //Initialize contracted matrix to the appropriate dimensions
+        std::vector< std::vector< T, A >, B > matrix_contraction( NDI + NSHR,
+                                                                  std::vector< T, A >( NDI + NSHR, T( ), full_abaqus_matrix[ 0 ].get_allocator( ) ),
+                                                                  full_abaqus_matrix.get_allocator( ) );
+
+        //Loop the non-zero component rows and columns from their full matrix positions
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR );
+        for ( unsigned int row = 0; row < component_map.ntens; row++ ){
+            const std::vector< T, A > &full_row = full_abaqus_matrix[ component_map.contracted_to_full[ row ] ];
+            for ( unsigned int col = 0; col < component_map.ntens; col++ ){
+                matrix_contraction[ row ][ col ] = full_row[ component_map.contracted_to_full[ col ] ];
+            }
+        }
+
+        return matrix_contraction;
+    }
+
+    template< typename T, class A >
+    inline std::vector< T, A > expandFullNTENSTensor( const std::vector< T, A > &long_vector,
+                                                      const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major vector from the expanded Abaqus stress-type NTENS vector of
+         * length 6. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * ``tardigradeAbaqusTools::expandAbaqusNTENSVector`` returns
+         *
+         * Abaqus/Standard (UMAT)
+         *
+         *     long_vector[]            0            1            2          3          4          5
+         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23}  }
+         *
+         * Abaqus/Explicit (VUMAT)
+         *
+         *     long_vector[]            0            1            2          3          4          5
+         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13}  }
+         *
+         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row major vector of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( long_vector.size( ) == 6, std::length_error, "The long vector size must be 6" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( long_vector, "long_vector" );
+
+        //Set the tensor packing order by Abaqus solver
+        const AbaqusComponentMap &component_map = abaqusComponentMap( 3, 3, abaqus_standard );
+
+        //Pack the row-major full tensor
+        std::vector< T, A > full_tensor( 9, T( ), long_vector.get_allocator( ) );
+        for ( unsigned int index = 0; index < 9; index++ ){
+            full_tensor[ index ] = long_vector[ component_map.tensor_to_contracted[ index ] ];
+        }
+
+        return full_tensor;
+
+    }
+
+    template< typename T, class A >
+    inline std::vector< T, A > expandFullNTENSTensor( const std::vector< T, A > &abaqus_vector,
+                                                      const int &NDI, const int &NSHR,
+                                                      const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major vector from the contracted Abaqus stress-type vector of length
+         * NDI + NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row-major vector of length 9.
+         */
+
+        //Expand the stress-type vector
+        std::vector< T, A > long_vector = tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR );
+
+        //Expand the full tensor
+        std::vector< T, A > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, abaqus_standard );
+
+        return full_tensor;
+
+    }
+
+    template< typename T, class A >
+    inline std::vector< T, A > contractFullNTENSTensor( const std::vector< T, A > &full_tensor,
+                                                        const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into the full Abaqus stress-type vector of length 6.
+         * Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * The full tensor is stored as a row-major vector
+         *
+         *     full_tensor[]            0            1            2
+         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
+         *
+         *     full_tensor[]            3            4            5
+         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         *
+         *     full_tensor[]            6            7            8
+         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         *
+         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &full_abaqus_vector: an expanded abaqus stress-type vector. Length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( full_tensor.size( ) == 9, std::length_error, "The full tensor size must be 9" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( full_tensor, "full_tensor" );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const AbaqusComponentMap &component_map = abaqusComponentMap( 3, 3, abaqus_standard );
+
+        //Unpack the row-major full tensor
+        std::vector< T, A > full_abaqus_vector( 6, T( ), full_tensor.get_allocator( ) );
+        for ( unsigned int index = 0; index < 6; index++ ){
+            full_abaqus_vector[ index ] = full_tensor[ component_map.contracted_to_tensor[ index ] ];
         }
 
-        //Unpack shear components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NSHR; index++ ){
-            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
-        }
+        return full_abaqus_vector;
+
+    }
+
+    template< typename T, class A >
+    inline std::vector< T, A > contractFullNTENSTensor( const std::vector< T, A > &full_tensor,
+                                                        const int &NDI, const int &NSHR,
+                                                        const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector of length NDI +
+         * NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * The full tensor is stored as a row-major vector
+         *
+         *     full_tensor[]            0            1            2
+         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
+         *
+         *     full_tensor[]            3            4            5
+         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         *
+         *     full_tensor[]            6            7            8
+         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         *
+         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &abaqus_vector: a contracted abaqus stress-type vector. Length NDI + NSHR.
+         */
+
+        //Contract to full length (6) abaqus stress-type vector
+        std::vector< T, A > full_abaqus_vector = contractFullNTENSTensor( full_tensor, abaqus_standard );
+
+        //Contract the full length (6) vector to an abaqus stress-type vector of length NDI + NSHR
+        std::vector< T, A > abaqus_vector = contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR );
+
+        return abaqus_vector;
+
+    }
+
+    template< typename T, class A, class B >
+    inline std::vector< std::vector< T, A >, B > contractFullNTENSMatrix( const std::vector< std::vector< T, A >, B > &full_matrix,
+                                                                          const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into the expected order for an expanded (6x6) Abaqus NTENS matrix. Handle the
+         * stress-type element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * Full 9x9 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
+         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
+         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
+         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         *
+         * Abaqus/Standard 6x6 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * The Abaqus/Explicit 6x6 Matrix swaps the last two rows and columns for the \f$ 23 \f$ and \f$ 13 \f$ components.
+         *
+         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_abaqus_matrix: Expanded 6x6 Voigt matrix with the Abaqus solver element ordering.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_SHAPE( full_matrix, 9, 9, "The full matrix must be 9x9" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE( full_matrix, "full_matrix" );
+
+        //Initialize the output matrix
+        std::vector< std::vector< T, A >, B > full_abaqus_matrix( 6, std::vector< T, A >( 6, T( ), full_matrix[ 0 ].get_allocator( ) ),
+                                                                  full_matrix.get_allocator( ) );
+
+        //Set the packing order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = abaqusComponentMap( 3, 3, abaqus_standard ).contracted_to_tensor;
+
+        //Repack the full matrix for Abaqus
+        for ( unsigned int i = 0; i < 6; i++ ){
+            for ( unsigned int j = 0; j < 6; j++ ){
+                full_abaqus_matrix[ i ][ j ] = full_matrix[ tensorOrder[ i ] ][ tensorOrder[ j ] ];
+            }
+        }
+
+        return full_abaqus_matrix;
+
+    }
+
+    template< typename T, class A, class B >
+    inline std::vector< std::vector < T, A >, B > contractFullNTENSMatrix( const std::vector< std::vector< T, A >, B > &full_matrix,
+                                                                           const int &NDI, const int &NSHR,
+                                                                           const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into the expected order for the contracted (NTENSxNTENS) Abaqus NTENS matrix. Handle
+         * the stress-type element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * Full 9x9 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
+         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
+         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
+         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         *
+         * Abaqus/Standard 6x6 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * Where the output matrix from this function omits the by-definition zero valued components determined by NDI
+         * and NSHR.
+         *
+         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &abaqus_matrix: A contracted Abaqus Voigt matrix with dimensions NTENSxNTENS where NTENS = NDI +
+         *                          NSHR.
+         */
+
+        //Detruct to 6x6
+        std::vector< std::vector< T, A >, B > full_abaqus_matrix = contractFullNTENSMatrix( full_matrix, abaqus_standard );
+
+        //Contract to NTENSxNTENS
+        std::vector< std::vector< T, A >, B > abaqus_matrix = contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR );
+
+        return abaqus_matrix;
+
+    }
+
+
+    template< typename T >
+    inline void expandFullNTENSTensor( const T *abaqus_vector, const int &NDI, const int &NSHR, T *full_tensor,
+                                       const bool abaqus_standard = true ){
+        /*!
+         * Fused, allocation free expansion of a contracted Abaqus stress-type vector of length NDI + NSHR, e.g.
+         * ``STRESS``, directly into a full 3x3 tensor stored as a row-major array of length 9. Uses the same component
+         * tables as the ``std::vector`` interface.
+         *
+         * \param *abaqus_vector: an abaqus stress-type array with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param *full_tensor: The output row-major tensor array of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( abaqus_vector, NDI + NSHR, "abaqus_vector" );
+
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR, abaqus_standard );
+        for ( unsigned int index = 0; index < 9; index++ ){
+            const int component = component_map.tensor_to_contracted[ index ];
+            full_tensor[ index ] = ( component < 0 ) ? T( 0 ) : abaqus_vector[ component ];
+        }
+
+        return;
+    }
+
+    template< typename T >
+    inline void contractFullNTENSTensor( const T *full_tensor, const int &NDI, const int &NSHR, T *abaqus_vector,
+                                         const bool abaqus_standard = true ){
+        /*!
+         * Fused, allocation free contraction of a full 3x3 tensor stored as a row-major array of length 9 directly into
+         * an Abaqus stress-type array of length NDI + NSHR, e.g. ``STRESS``. Uses the same component tables as the
+         * ``std::vector`` interface.
+         *
+         * \param *full_tensor: The row-major tensor array of length 9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param *abaqus_vector: The output abaqus stress-type array. Length NDI + NSHR.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( full_tensor, 9, "full_tensor" );
+
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR, abaqus_standard );
+        for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+            abaqus_vector[ index ] = full_tensor[ component_map.contracted_to_tensor[ index ] ];
+        }
+
+        return;
+    }
+
+    template< typename T >
+    inline void contractFullNTENSMatrix( const T *full_matrix, const int &NDI, const int &NSHR, T *abaqus_matrix,
+                                         const bool abaqus_standard = true ){
+        /*!
+         * Fused, allocation free contraction of a full 9x9 matrix stored as a row-major array of length 81 directly into
+         * a Fortran column-major (NTENS, NTENS) Abaqus matrix, e.g. ``DDSDDE``. Uses the same component tables as the
+         * ``std::vector`` interface, so the result matches ``rowToColumnMajor`` applied to ``contractFullNTENSMatrix``.
+         *
+         * \param *full_matrix: The row-major 9x9 matrix array of length 81.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param *abaqus_matrix: The output column-major (NTENS, NTENS) matrix where NTENS = NDI + NSHR.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( full_matrix, 81, "full_matrix" );
+
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR, abaqus_standard );
+        const unsigned int ntens = component_map.ntens;
+        for ( unsigned int column = 0; column < ntens; column++ ){
+            const unsigned int tensor_column = component_map.contracted_to_tensor[ column ];
+            for ( unsigned int row = 0; row < ntens; row++ ){
+                abaqus_matrix[ column * ntens + row ] = full_matrix[ 9 * component_map.contracted_to_tensor[ row ] + tensor_column ];
+            }
+        }
+
+        return;
+    }
+
+    template< typename T >
+    inline void computeVUMATPointRotation( const int &nblock, const int &ndir, const int &nshr,
+                                           const T *stretch, const T *defgrad, const int &point, T rotation[ 3 ][ 3 ] ){
+        /*!
+         * Compute the rotation from the corotational frame to the reference frame for a single point of an
+         * Abaqus/Explicit (VUMAT) block from the polar decomposition
+         *
+         * \f$ R_{ij} = F_{ik} U^{-1}_{kj} \f$
+         *
+         * The VUMAT block arrays are Fortran column-major arrays with the point index fastest, e.g. ``stretchNew`` has
+         * dimensions (nblock, ndir + nshr) and ``defgradNew`` has dimensions (nblock, ndir + nshr + nshr). The stretch
+         * components are stored in the Abaqus/Explicit stress-type order
+         *
+         * \f$ \left ( U_{11}, U_{22}, U_{33}, U_{12}, U_{23}, U_{13} \right ) \f$
+         *
+         * and the deformation gradient components are stored as
+         *
+         * \f$ \left ( F_{11}, F_{22}, F_{33}, F_{12}, F_{23}, F_{31}, F_{21}, F_{32}, F_{13} \right ) \f$
+         *
+         * where components omitted by NDIR and NSHR, e.g. \f$ \left ( F_{11}, F_{22}, F_{33}, F_{12}, F_{21} \right )\f$
+         * for two dimensional elements, are the identity.
+         *
+         * \param &nblock: The number of points in the block. The leading dimension of the block arrays.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *stretch: The column-major (nblock, ndir + nshr) stretch block, e.g. ``stretchNew``.
+         * \param *defgrad: The column-major (nblock, ndir + nshr + nshr) deformation gradient block, e.g.
+         *     ``defgradNew``.
+         * \param &point: The block index of the point.
+         * \param rotation: The output 3x3 rotation.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( point >= 0 ) && ( point < nblock ), std::out_of_range,
+                                       "The point must be in [0, nblock)" );
+
+        //Gather the point stretch and deformation gradient through the Abaqus/Explicit component maps
+        const AbaqusComponentMap &stretch_map = abaqusComponentMap( ndir, nshr, false );
+        const AbaqusDeformationGradientMap &defgrad_map = abaqusDeformationGradientMap( ndir, nshr );
+        T U[ 3 ][ 3 ] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+        T F[ 3 ][ 3 ] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+        for ( unsigned int index = 0; index < stretch_map.ntens; index++ ){
+            const T value = stretch[ index * nblock + point ];
+            const unsigned int tensor_index = stretch_map.contracted_to_tensor[ index ];
+            U[ tensor_index / 3 ][ tensor_index % 3 ] = value;
+            U[ tensor_index % 3 ][ tensor_index / 3 ] = value;
+        }
+        for ( unsigned int index = 0; index < defgrad_map.ncomponents; index++ ){
+            const unsigned int tensor_index = defgrad_map.component_to_tensor[ index ];
+            F[ tensor_index / 3 ][ tensor_index % 3 ] = defgrad[ index * nblock + point ];
+        }
+
+        //Invert the symmetric stretch with the cofactor matrix
+        const T c00 = U[ 1 ][ 1 ] * U[ 2 ][ 2 ] - U[ 1 ][ 2 ] * U[ 1 ][ 2 ];
+        const T c01 = U[ 1 ][ 2 ] * U[ 0 ][ 2 ] - U[ 0 ][ 1 ] * U[ 2 ][ 2 ];
+        const T c02 = U[ 0 ][ 1 ] * U[ 1 ][ 2 ] - U[ 1 ][ 1 ] * U[ 0 ][ 2 ];
+        const T c11 = U[ 0 ][ 0 ] * U[ 2 ][ 2 ] - U[ 0 ][ 2 ] * U[ 0 ][ 2 ];
+        const T c12 = U[ 0 ][ 1 ] * U[ 0 ][ 2 ] - U[ 0 ][ 0 ] * U[ 1 ][ 2 ];
+        const T c22 = U[ 0 ][ 0 ] * U[ 1 ][ 1 ] - U[ 0 ][ 1 ] * U[ 0 ][ 1 ];
+        const T inverse_determinant = 1 / ( U[ 0 ][ 0 ] * c00 + U[ 0 ][ 1 ] * c01 + U[ 0 ][ 2 ] * c02 );
+        const T Uinv[ 3 ][ 3 ] = { { c00 * inverse_determinant, c01 * inverse_determinant, c02 * inverse_determinant },
+                                   { c01 * inverse_determinant, c11 * inverse_determinant, c12 * inverse_determinant },
+                                   { c02 * inverse_determinant, c12 * inverse_determinant, c22 * inverse_determinant } };
+
+        for ( int i = 0; i < 3; i++ ){
+            for ( int j = 0; j < 3; j++ ){
+                rotation[ i ][ j ] = F[ i ][ 0 ] * Uinv[ 0 ][ j ] + F[ i ][ 1 ] * Uinv[ 1 ][ j ] + F[ i ][ 2 ] * Uinv[ 2 ][ j ];
+            }
+        }
+        for ( int i = 0; i < 3; i++ ){
+            TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( rotation[ i ], 3, "rotation" );
+        }
+
+        return;
+    }
+
+    template< typename T >
+    inline void rotateVUMATPoint( const int &nblock, const int &ndir, const int &nshr, const T Q[ 3 ][ 3 ],
+                                  const T *input_block, T *output_block, const int &point ){
+        /*!
+         * Compute \f$ Q_{ik} A_{kl} Q_{jl} \f$ for a single point of a symmetric Abaqus/Explicit (VUMAT) stress-type
+         * block. The block components are stored in the Abaqus/Explicit stress-type order
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \sigma_{12}, \sigma_{23}, \sigma_{13} \right ) \f$
+         *
+         * The point is read completely before it is written, so the input and output blocks may be the same array.
+         *
+         * \param &nblock: The number of points in the block. The leading dimension of the block arrays.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param Q: The 3x3 rotation to apply.
+         * \param *input_block: The column-major (nblock, ndir + nshr) stress-type block to rotate.
+         * \param *output_block: The column-major (nblock, ndir + nshr) rotated stress-type block.
+         * \param &point: The block index of the point.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        //Gather the symmetric point tensor through the Abaqus/Explicit component map
+        const AbaqusComponentMap &component_map = abaqusComponentMap( ndir, nshr, false );
+        T A[ 3 ][ 3 ] = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } };
+        for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+            const T value = input_block[ index * nblock + point ];
+            const unsigned int tensor_index = component_map.contracted_to_tensor[ index ];
+            A[ tensor_index / 3 ][ tensor_index % 3 ] = value;
+            A[ tensor_index % 3 ][ tensor_index / 3 ] = value;
+        }
+
+        //Compute Q A Q^T and scatter the non-zero components
+        T QA[ 3 ][ 3 ];
+        for ( int i = 0; i < 3; i++ ){
+            for ( int j = 0; j < 3; j++ ){
+                QA[ i ][ j ] = Q[ i ][ 0 ] * A[ 0 ][ j ] + Q[ i ][ 1 ] * A[ 1 ][ j ] + Q[ i ][ 2 ] * A[ 2 ][ j ];
+            }
+        }
+        for ( unsigned int index = 0; index < component_map.ntens; index++ ){
+            const unsigned int i = component_map.contracted_to_tensor[ index ] / 3;
+            const unsigned int j = component_map.contracted_to_tensor[ index ] % 3;
+            output_block[ index * nblock + point ] = QA[ i ][ 0 ] * Q[ j ][ 0 ]
+                                                   + QA[ i ][ 1 ] * Q[ j ][ 1 ]
+                                                   + QA[ i ][ 2 ] * Q[ j ][ 2 ];
+        }
+
+        return;
+    }
+
+    template< int COMPONENT, typename T >
+    inline T loadVUMATLane( const T *block, const int nblock, const int point, const T absent ){
+        /*!
+         * Load a point of a block component fixed at compile time. Components omitted by ndir and nshr have a
+         * negative index and load the absent value without touching the block.
+         *
+         * \param *block: The column-major (nblock, ncomponents) block
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param absent: The value of an omitted component
+         */
+        if constexpr ( COMPONENT < 0 ){
+            return absent;
+        }
+        else{
+            return block[ COMPONENT * nblock + point ];
+        }
+    }
+
+    template< int COMPONENT, typename T >
+    inline void storeVUMATLane( T *block, const int nblock, const int point, const T value ){
+        /*!
+         * Store a point of a block component fixed at compile time. Components omitted by ndir and nshr have a
+         * negative index and are not stored.
+         *
+         * \param *block: The column-major (nblock, ncomponents) block
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param value: The value to store
+         */
+        if constexpr ( COMPONENT >= 0 ){
+            block[ COMPONENT * nblock + point ] = value;
+        }
+    }
+
+    template< typename T, int NDIR, int NSHR >
+    inline void loadVUMATSymmetricLanes( const T *block, const int nblock, const int point, const T diagonal, T a[ 6 ] ){
+        /*!
+         * Load a point of a symmetric Abaqus/Explicit stress-type block as \f$ A_{11}, A_{22}, A_{33}, A_{12}, A_{23},
+         * A_{13} \f$. Omitted direct components are the diagonal value and omitted shear components are zero.
+         *
+         * \param *block: The column-major (nblock, NDIR + NSHR) stress-type block
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param diagonal: The value of omitted direct components
+         * \param a: The loaded components
+         */
+        constexpr AbaqusComponentMap component_map = makeAbaqusComponentMap( NDIR, NSHR, false );
+        a[ 0 ] = loadVUMATLane< component_map.tensor_to_contracted[ 0 ] >( block, nblock, point, diagonal );
+        a[ 1 ] = loadVUMATLane< component_map.tensor_to_contracted[ 4 ] >( block, nblock, point, diagonal );
+        a[ 2 ] = loadVUMATLane< component_map.tensor_to_contracted[ 8 ] >( block, nblock, point, diagonal );
+        a[ 3 ] = loadVUMATLane< component_map.tensor_to_contracted[ 1 ] >( block, nblock, point, T( 0 ) );
+        a[ 4 ] = loadVUMATLane< component_map.tensor_to_contracted[ 5 ] >( block, nblock, point, T( 0 ) );
+        a[ 5 ] = loadVUMATLane< component_map.tensor_to_contracted[ 2 ] >( block, nblock, point, T( 0 ) );
+    }
+
+    template< typename T, int NDIR, int NSHR >
+    inline void storeVUMATSymmetricLanes( const T a[ 6 ], const int nblock, const int point, T *block ){
+        /*!
+         * Store the components \f$ A_{11}, A_{22}, A_{33}, A_{12}, A_{23}, A_{13} \f$ of a point into a symmetric
+         * Abaqus/Explicit stress-type block. Components omitted by NDIR and NSHR are not stored.
+         *
+         * \param a: The components to store
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param *block: The column-major (nblock, NDIR + NSHR) stress-type block
+         */
+        constexpr AbaqusComponentMap component_map = makeAbaqusComponentMap( NDIR, NSHR, false );
+        storeVUMATLane< component_map.tensor_to_contracted[ 0 ] >( block, nblock, point, a[ 0 ] );
+        storeVUMATLane< component_map.tensor_to_contracted[ 4 ] >( block, nblock, point, a[ 1 ] );
+        storeVUMATLane< component_map.tensor_to_contracted[ 8 ] >( block, nblock, point, a[ 2 ] );
+        storeVUMATLane< component_map.tensor_to_contracted[ 1 ] >( block, nblock, point, a[ 3 ] );
+        storeVUMATLane< component_map.tensor_to_contracted[ 5 ] >( block, nblock, point, a[ 4 ] );
+        storeVUMATLane< component_map.tensor_to_contracted[ 2 ] >( block, nblock, point, a[ 5 ] );
+    }
+
+    template< typename T, int NDIR, int NSHR >
+    inline void loadVUMATRotationLanes( const T *stretch, const T *defgrad, const int nblock, const int point, T r[ 9 ] ){
+        /*!
+         * Compute the row-major rotation \f$ R = F U^{-1} \f$ of a point from the Abaqus/Explicit stretch and
+         * deformation gradient blocks with straight-line component arithmetic. Omitted components are the identity.
+         *
+         * \param *stretch: The column-major (nblock, NDIR + NSHR) stretch block
+         * \param *defgrad: The column-major (nblock, NDIR + NSHR + NSHR) deformation gradient block
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param r: The row-major 3x3 rotation
+         */
+        constexpr AbaqusDeformationGradientMap defgrad_map = makeAbaqusDeformationGradientMap( NDIR, NSHR );
+
+        T u[ 6 ];
+        loadVUMATSymmetricLanes< T, NDIR, NSHR >( stretch, nblock, point, T( 1 ), u );
+        const T f00 = loadVUMATLane< defgrad_map.tensor_to_component[ 0 ] >( defgrad, nblock, point, T( 1 ) );
+        const T f01 = loadVUMATLane< defgrad_map.tensor_to_component[ 1 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f02 = loadVUMATLane< defgrad_map.tensor_to_component[ 2 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f10 = loadVUMATLane< defgrad_map.tensor_to_component[ 3 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f11 = loadVUMATLane< defgrad_map.tensor_to_component[ 4 ] >( defgrad, nblock, point, T( 1 ) );
+        const T f12 = loadVUMATLane< defgrad_map.tensor_to_component[ 5 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f20 = loadVUMATLane< defgrad_map.tensor_to_component[ 6 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f21 = loadVUMATLane< defgrad_map.tensor_to_component[ 7 ] >( defgrad, nblock, point, T( 0 ) );
+        const T f22 = loadVUMATLane< defgrad_map.tensor_to_component[ 8 ] >( defgrad, nblock, point, T( 1 ) );
+
+        //Invert the symmetric stretch with the cofactor matrix
+        const T c00 = u[ 1 ] * u[ 2 ] - u[ 4 ] * u[ 4 ];
+        const T c01 = u[ 4 ] * u[ 5 ] - u[ 3 ] * u[ 2 ];
+        const T c02 = u[ 3 ] * u[ 4 ] - u[ 1 ] * u[ 5 ];
+        const T c11 = u[ 0 ] * u[ 2 ] - u[ 5 ] * u[ 5 ];
+        const T c12 = u[ 3 ] * u[ 5 ] - u[ 0 ] * u[ 4 ];
+        const T c22 = u[ 0 ] * u[ 1 ] - u[ 3 ] * u[ 3 ];
+        const T inverse_determinant = 1 / ( u[ 0 ] * c00 + u[ 3 ] * c01 + u[ 5 ] * c02 );
+        const T i00 = c00 * inverse_determinant, i01 = c01 * inverse_determinant, i02 = c02 * inverse_determinant;
+        const T i11 = c11 * inverse_determinant, i12 = c12 * inverse_determinant, i22 = c22 * inverse_determinant;
+
+        r[ 0 ] = f00 * i00 + f01 * i01 + f02 * i02;
+        r[ 1 ] = f00 * i01 + f01 * i11 + f02 * i12;
+        r[ 2 ] = f00 * i02 + f01 * i12 + f02 * i22;
+        r[ 3 ] = f10 * i00 + f11 * i01 + f12 * i02;
+        r[ 4 ] = f10 * i01 + f11 * i11 + f12 * i12;
+        r[ 5 ] = f10 * i02 + f11 * i12 + f12 * i22;
+        r[ 6 ] = f20 * i00 + f21 * i01 + f22 * i02;
+        r[ 7 ] = f20 * i01 + f21 * i11 + f22 * i12;
+        r[ 8 ] = f20 * i02 + f21 * i12 + f22 * i22;
+    }
+
+    template< typename T, int NDIR, int NSHR, bool TRANSPOSE >
+    inline void rotateVUMATLanes( const T r[ 9 ], const T *input_block, const int nblock, const int point, T *output_block ){
+        /*!
+         * Compute \f$ Q_{ik} A_{kl} Q_{jl} \f$ for a point of a symmetric Abaqus/Explicit stress-type block with
+         * straight-line component arithmetic, where \f$ Q = R \f$, or \f$ Q = R^T \f$ if TRANSPOSE is true. The point
+         * is read completely before it is written.
+         *
+         * \param r: The row-major 3x3 rotation
+         * \param *input_block: The column-major (nblock, NDIR + NSHR) stress-type block to rotate
+         * \param nblock: The number of points in the block.
+         * \param point: The block index of the point.
+         * \param *output_block: The column-major (nblock, NDIR + NSHR) rotated stress-type block
+         */
+        const T q00 = r[ 0 ];
+        const T q01 = TRANSPOSE ? r[ 3 ] : r[ 1 ];
+        const T q02 = TRANSPOSE ? r[ 6 ] : r[ 2 ];
+        const T q10 = TRANSPOSE ? r[ 1 ] : r[ 3 ];
+        const T q11 = r[ 4 ];
+        const T q12 = TRANSPOSE ? r[ 7 ] : r[ 5 ];
+        const T q20 = TRANSPOSE ? r[ 2 ] : r[ 6 ];
+        const T q21 = TRANSPOSE ? r[ 5 ] : r[ 7 ];
+        const T q22 = r[ 8 ];
+
+        T a[ 6 ];
+        loadVUMATSymmetricLanes< T, NDIR, NSHR >( input_block, nblock, point, T( 0 ), a );
+
+        //Q A with A = ( ( a0, a3, a5 ), ( a3, a1, a4 ), ( a5, a4, a2 ) )
+        const T qa00 = q00 * a[ 0 ] + q01 * a[ 3 ] + q02 * a[ 5 ];
+        const T qa01 = q00 * a[ 3 ] + q01 * a[ 1 ] + q02 * a[ 4 ];
+        const T qa02 = q00 * a[ 5 ] + q01 * a[ 4 ] + q02 * a[ 2 ];
+        const T qa10 = q10 * a[ 0 ] + q11 * a[ 3 ] + q12 * a[ 5 ];
+        const T qa11 = q10 * a[ 3 ] + q11 * a[ 1 ] + q12 * a[ 4 ];
+        const T qa12 = q10 * a[ 5 ] + q11 * a[ 4 ] + q12 * a[ 2 ];
+        const T qa20 = q20 * a[ 0 ] + q21 * a[ 3 ] + q22 * a[ 5 ];
+        const T qa21 = q20 * a[ 3 ] + q21 * a[ 1 ] + q22 * a[ 4 ];
+        const T qa22 = q20 * a[ 5 ] + q21 * a[ 4 ] + q22 * a[ 2 ];
+
+        const T b[ 6 ] = { qa00 * q00 + qa01 * q01 + qa02 * q02,
+                           qa10 * q10 + qa11 * q11 + qa12 * q12,
+                           qa20 * q20 + qa21 * q21 + qa22 * q22,
+                           qa00 * q10 + qa01 * q11 + qa02 * q12,
+                           qa10 * q20 + qa11 * q21 + qa12 * q22,
+                           qa00 * q20 + qa01 * q21 + qa02 * q22 };
+        storeVUMATSymmetricLanes< T, NDIR, NSHR >( b, nblock, point, output_block );
+    }
+
+    template< typename T, int NDIR, int NSHR >
+    inline void computeVUMATRotationKernel( const int nblock, const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT stretch,
+                                            const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT defgrad,
+                                            T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT rotation ){
+        /*!
+         * The vectorizable point loop of ``tardigradeAbaqusTools::computeVUMATRotationBlock``
+         */
+        TARDIGRADE_ABAQUS_TOOLS_IVDEP
+        for ( int point = 0; point < nblock; point++ ){
+            T r[ 9 ];
+            loadVUMATRotationLanes< T, NDIR, NSHR >( stretch, defgrad, nblock, point, r );
+            storeVUMATLane< 0 >( rotation, nblock, point, r[ 0 ] );
+            storeVUMATLane< 1 >( rotation, nblock, point, r[ 1 ] );
+            storeVUMATLane< 2 >( rotation, nblock, point, r[ 2 ] );
+            storeVUMATLane< 3 >( rotation, nblock, point, r[ 3 ] );
+            storeVUMATLane< 4 >( rotation, nblock, point, r[ 4 ] );
+            storeVUMATLane< 5 >( rotation, nblock, point, r[ 5 ] );
+            storeVUMATLane< 6 >( rotation, nblock, point, r[ 6 ] );
+            storeVUMATLane< 7 >( rotation, nblock, point, r[ 7 ] );
+            storeVUMATLane< 8 >( rotation, nblock, point, r[ 8 ] );
+        }
+    }
+
+    template< typename T, int NDIR, int NSHR, bool TRANSPOSE >
+    inline void rotateVUMATKernel( const int nblock, const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT rotation,
+                                   const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT input_block,
+                                   T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT output_block ){
+        /*!
+         * The vectorizable point loop of ``tardigradeAbaqusTools::pushForwardVUMATBlock`` and
+         * ``tardigradeAbaqusTools::pullBackVUMATBlock`` with a rotation block and distinct input and output blocks
+         */
+        TARDIGRADE_ABAQUS_TOOLS_IVDEP
+        for ( int point = 0; point < nblock; point++ ){
+            const T r[ 9 ] = { rotation[ 0 * nblock + point ], rotation[ 1 * nblock + point ], rotation[ 2 * nblock + point ],
+                               rotation[ 3 * nblock + point ], rotation[ 4 * nblock + point ], rotation[ 5 * nblock + point ],
+                               rotation[ 6 * nblock + point ], rotation[ 7 * nblock + point ], rotation[ 8 * nblock + point ] };
+            rotateVUMATLanes< T, NDIR, NSHR, TRANSPOSE >( r, input_block, nblock, point, output_block );
+        }
+    }
+
+    template< typename T, int NDIR, int NSHR, bool TRANSPOSE >
+    inline void rotateVUMATKernel( const int nblock, const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT rotation,
+                                   T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT block ){
+        /*!
+         * The vectorizable point loop of ``tardigradeAbaqusTools::pushForwardVUMATBlock`` and
+         * ``tardigradeAbaqusTools::pullBackVUMATBlock`` with a rotation block, rotating the block in place
+         */
+        TARDIGRADE_ABAQUS_TOOLS_IVDEP
+        for ( int point = 0; point < nblock; point++ ){
+            const T r[ 9 ] = { rotation[ 0 * nblock + point ], rotation[ 1 * nblock + point ], rotation[ 2 * nblock + point ],
+                               rotation[ 3 * nblock + point ], rotation[ 4 * nblock + point ], rotation[ 5 * nblock + point ],
+                               rotation[ 6 * nblock + point ], rotation[ 7 * nblock + point ], rotation[ 8 * nblock + point ] };
+            rotateVUMATLanes< T, NDIR, NSHR, TRANSPOSE >( r, block, nblock, point, block );
+        }
+    }
+
+    template< typename T, int NDIR, int NSHR, bool TRANSPOSE >
+    inline void rotateVUMATStretchKernel( const int nblock, const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT stretch,
+                                          const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT defgrad,
+                                          const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT input_block,
+                                          T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT output_block ){
+        /*!
+         * The vectorizable point loop of ``tardigradeAbaqusTools::pushForwardVUMATBlock`` and
+         * ``tardigradeAbaqusTools::pullBackVUMATBlock`` from the stretch and deformation gradient blocks with distinct
+         * input and output blocks
+         */
+        TARDIGRADE_ABAQUS_TOOLS_IVDEP
+        for ( int point = 0; point < nblock; point++ ){
+            T r[ 9 ];
+            loadVUMATRotationLanes< T, NDIR, NSHR >( stretch, defgrad, nblock, point, r );
+            rotateVUMATLanes< T, NDIR, NSHR, TRANSPOSE >( r, input_block, nblock, point, output_block );
+        }
+    }
+
+    template< typename T, int NDIR, int NSHR, bool TRANSPOSE >
+    inline void rotateVUMATStretchKernel( const int nblock, const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT stretch,
+                                          const T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT defgrad,
+                                          T *TARDIGRADE_ABAQUS_TOOLS_RESTRICT block ){
+        /*!
+         * The vectorizable point loop of ``tardigradeAbaqusTools::pushForwardVUMATBlock`` and
+         * ``tardigradeAbaqusTools::pullBackVUMATBlock`` from the stretch and deformation gradient blocks, rotating
+         * the block in place
+         */
+        TARDIGRADE_ABAQUS_TOOLS_IVDEP
+        for ( int point = 0; point < nblock; point++ ){
+            T r[ 9 ];
+            loadVUMATRotationLanes< T, NDIR, NSHR >( stretch, defgrad, nblock, point, r );
+            rotateVUMATLanes< T, NDIR, NSHR, TRANSPOSE >( r, block, nblock, point, block );
+        }
+    }
+
+    template< int NDIR, class Kernel >
+    inline void dispatchVUMATShearComponents( const int &nshr, Kernel &&kernel ){
+        /*!
+         * Call a block kernel instantiated for NDIR and the runtime number of shear components. See
+         * ``tardigradeAbaqusTools::dispatchVUMATComponents``.
+         */
+        switch ( nshr ){
+            case 0: kernel( std::integral_constant< int, NDIR >( ), std::integral_constant< int, 0 >( ) ); return;
+            case 1: kernel( std::integral_constant< int, NDIR >( ), std::integral_constant< int, 1 >( ) ); return;
+            case 2: kernel( std::integral_constant< int, NDIR >( ), std::integral_constant< int, 2 >( ) ); return;
+            case 3: kernel( std::integral_constant< int, NDIR >( ), std::integral_constant< int, 3 >( ) ); return;
+            default: throw std::out_of_range( "nshr = " + std::to_string( nshr ) + " must be in [0, 3]" );
+        }
+    }
+
+    template< class Kernel >
+    inline void dispatchVUMATComponents( const int &ndir, const int &nshr, Kernel &&kernel ){
+        /*!
+         * Call a block kernel instantiated for the runtime number of direct and shear components, so the ndir and
+         * nshr dispatch happens once per block instead of inside the point loop. The kernel is called with
+         * ``std::integral_constant`` values of ndir and nshr.
+         *
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param &&kernel: The kernel to call
+         */
+        switch ( ndir ){
+            case 1: dispatchVUMATShearComponents< 1 >( nshr, kernel ); return;
+            case 2: dispatchVUMATShearComponents< 2 >( nshr, kernel ); return;
+            case 3: dispatchVUMATShearComponents< 3 >( nshr, kernel ); return;
+            default: throw std::out_of_range( "ndir = " + std::to_string( ndir ) + " must be in [1, 3]" );
+        }
+    }
+
+    template< typename T >
+    inline void computeVUMATRotationBlock( const int &nblock, const int &ndir, const int &nshr,
+                                           const T *stretch, const T *defgrad, T *rotation ){
+        /*!
+         * Compute the rotation from the corotational frame to the reference frame for every point of an
+         * Abaqus/Explicit (VUMAT) block. See ``tardigradeAbaqusTools::computeVUMATPointRotation`` for the block
+         * component ordering.
+         *
+         * \param &nblock: The number of points in the block.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *stretch: The column-major (nblock, ndir + nshr) stretch block, e.g. ``stretchNew``.
+         * \param *defgrad: The column-major (nblock, ndir + nshr + nshr) deformation gradient block, e.g.
+         *     ``defgradNew``.
+         * \param *rotation: The output column-major (nblock, 9) rotation block. The second index is the row-major 3x3
+         *     tensor index. Must not overlap the stretch and deformation gradient blocks.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        dispatchVUMATComponents( ndir, nshr, [ & ]( auto NDIR, auto NSHR ){
+            computeVUMATRotationKernel< T, decltype( NDIR )::value, decltype( NSHR )::value >( nblock, stretch, defgrad, rotation );
+        } );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( rotation, 9 * nblock, "rotation" );
+
+        return;
+    }
+
+    template< typename T >
+    inline void pushForwardVUMATBlock( const int &nblock, const int &ndir, const int &nshr, const T *rotation,
+                                       const T *corotational_block, T *reference_block ){
+        /*!
+         * Push forward a symmetric Abaqus/Explicit (VUMAT) stress-type block from the corotational frame to the
+         * reference frame with a previously computed rotation block
+         *
+         * \f$ \sigma_{ij} = R_{ik} \hat{\sigma}_{kl} R_{jl} \f$
+         *
+         * VUMAT strain blocks, e.g. ``strainInc``, store tensorial shear strains and are pushed forward the same way.
+         *
+         * \param &nblock: The number of points in the block.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *rotation: The column-major (nblock, 9) rotation block from
+         *     ``tardigradeAbaqusTools::computeVUMATRotationBlock``.
+         * \param *corotational_block: The column-major (nblock, ndir + nshr) corotational stress-type block, e.g.
+         *     ``stressNew``.
+         * \param *reference_block: The column-major (nblock, ndir + nshr) reference frame stress-type block. Either the
+         *     same array as the corotational block or not overlapping it.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        dispatchVUMATComponents( ndir, nshr, [ & ]( auto NDIR, auto NSHR ){
+            if ( corotational_block == reference_block ){
+                rotateVUMATKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, false >( nblock, rotation, reference_block );
+            }
+            else{
+                rotateVUMATKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, false >( nblock, rotation, corotational_block,
+                                                                                               reference_block );
+            }
+        } );
+
+        return;
+    }
+
+    template< typename T >
+    inline void pushForwardVUMATBlock( const int &nblock, const int &ndir, const int &nshr,
+                                       const T *stretch, const T *defgrad,
+                                       const T *corotational_block, T *reference_block ){
+        /*!
+         * Push forward a symmetric Abaqus/Explicit (VUMAT) stress-type block from the corotational frame to the
+         * reference frame. The rotation is computed point by point from the stretch and deformation gradient blocks
+         * without a rotation block buffer.
+         *
+         * \param &nblock: The number of points in the block.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *stretch: The column-major (nblock, ndir + nshr) stretch block, e.g. ``stretchNew``.
+         * \param *defgrad: The column-major (nblock, ndir + nshr + nshr) deformation gradient block, e.g.
+         *     ``defgradNew``.
+         * \param *corotational_block: The column-major (nblock, ndir + nshr) corotational stress-type block, e.g.
+         *     ``stressNew``.
+         * \param *reference_block: The column-major (nblock, ndir + nshr) reference frame stress-type block. Either the
+         *     same array as the corotational block or not overlapping it.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        dispatchVUMATComponents( ndir, nshr, [ & ]( auto NDIR, auto NSHR ){
+            if ( corotational_block == reference_block ){
+                rotateVUMATStretchKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, false >( nblock, stretch, defgrad,
+                                                                                                        reference_block );
+            }
+            else{
+                rotateVUMATStretchKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, false >( nblock, stretch, defgrad,
+                                                                                                        corotational_block, reference_block );
+            }
+        } );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( reference_block, nblock * ( ndir + nshr ), "reference_block" );
+
+        return;
+    }
+
+    template< typename T >
+    inline void pullBackVUMATBlock( const int &nblock, const int &ndir, const int &nshr, const T *rotation,
+                                    const T *reference_block, T *corotational_block ){
+        /*!
+         * Pull back a symmetric Abaqus/Explicit (VUMAT) stress-type block from the reference frame to the
+         * corotational frame with a previously computed rotation block
+         *
+         * \f$ \hat{\sigma}_{ij} = R_{ki} \sigma_{kl} R_{lj} \f$
+         *
+         * VUMAT strain blocks, e.g. ``strainInc``, store tensorial shear strains and are pulled back the same way.
+         *
+         * \param &nblock: The number of points in the block.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *rotation: The column-major (nblock, 9) rotation block from
+         *     ``tardigradeAbaqusTools::computeVUMATRotationBlock``.
+         * \param *reference_block: The column-major (nblock, ndir + nshr) reference frame stress-type block.
+         * \param *corotational_block: The column-major (nblock, ndir + nshr) corotational stress-type block, e.g.
+         *     ``stressNew``. Either the same array as the reference block or not overlapping it.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        dispatchVUMATComponents( ndir, nshr, [ & ]( auto NDIR, auto NSHR ){
+            if ( reference_block == corotational_block ){
+                rotateVUMATKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, true >( nblock, rotation, corotational_block );
+            }
+            else{
+                rotateVUMATKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, true >( nblock, rotation, reference_block,
+                                                                                              corotational_block );
+            }
+        } );
+
+        return;
+    }
+
+    template< typename T >
+    inline void pullBackVUMATBlock( const int &nblock, const int &ndir, const int &nshr,
+                                    const T *stretch, const T *defgrad,
+                                    const T *reference_block, T *corotational_block ){
+        /*!
+         * Pull back a symmetric Abaqus/Explicit (VUMAT) stress-type block from the reference frame to the
+         * corotational frame. The rotation is computed point by point from the stretch and deformation gradient
+         * blocks without a rotation block buffer.
+         *
+         * \param &nblock: The number of points in the block.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *stretch: The column-major (nblock, ndir + nshr) stretch block, e.g. ``stretchNew``.
+         * \param *defgrad: The column-major (nblock, ndir + nshr + nshr) deformation gradient block, e.g.
+         *     ``defgradNew``.
+         * \param *reference_block: The column-major (nblock, ndir + nshr) reference frame stress-type block.
+         * \param *corotational_block: The column-major (nblock, ndir + nshr) corotational stress-type block, e.g.
+         *     ``stressNew``. Either the same array as the reference block or not overlapping it.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+
+        dispatchVUMATComponents( ndir, nshr, [ & ]( auto NDIR, auto NSHR ){
+            if ( reference_block == corotational_block ){
+                rotateVUMATStretchKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, true >( nblock, stretch, defgrad,
+                                                                                                       corotational_block );
+            }
+            else{
+                rotateVUMATStretchKernel< T, decltype( NDIR )::value, decltype( NSHR )::value, true >( nblock, stretch, defgrad,
+                                                                                                       reference_block, corotational_block );
+            }
+        } );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( corotational_block, nblock * ( ndir + nshr ), "corotational_block" );
+
+        return;
+    }
+
+
+    template< typename T >
+    class SoABuffer{
+        /*!
+         * An aligned structure-of-arrays buffer of point values for vectorized constitutive kernels. Each component is a
+         * contiguous row of ``stride( )`` values, i.e. all points of component 0, then all points of component 1, ...
+         * The stride is the number of points rounded up to a multiple of TARDIGRADE_ABAQUS_TOOLS_SOA_LANES so every
+         * row starts on a lane boundary and kernels can loop over whole vector widths. The packing functions fill the
+         * padded lanes with the last point's values so full width kernels never see uninitialized or singular values.
+         *
+         * The buffer only reallocates when it grows, so a buffer reused across VUMAT calls allocates once.
+         */
+
+        public:
+
+            //! The number of points the row stride is padded to a multiple of
+            static const int lanes = TARDIGRADE_ABAQUS_TOOLS_SOA_LANES;
+
+            //! The alignment of the buffer. A cache line.
+            static const std::size_t alignment = 64;
+
+            SoABuffer( ) : _data( nullptr ), _capacity( 0 ), _components( 0 ), _points( 0 ), _stride( 0 ){ }
+
+            SoABuffer( const int &components, const int &points ) : SoABuffer( ){
+                /*!
+                 * Allocate a buffer
+                 *
+                 * \param &components: The number of components
+                 * \param &points: The number of points
+                 */
+                resize( components, points );
+            }
+
+            ~SoABuffer( ){
+                if ( _data ){
+                    ::operator delete( _data, std::align_val_t( alignment ) );
+                }
+            }
+
+            SoABuffer( const SoABuffer& ) = delete;
+
+            SoABuffer &operator=( const SoABuffer& ) = delete;
+
+            void resize( const int &components, const int &points ){
+                /*!
+                 * Set the shape of the buffer. The values are unspecified after a resize.
+                 *
+                 * \param &components: The number of components
+                 * \param &points: The number of points
+                 */
+                TARDIGRADE_ABAQUS_TOOLS_CHECK( ( components >= 0 ) && ( points >= 0 ), std::length_error,
+                                               "The number of components and points must be non-negative" );
+                _components = components;
+                _points = points;
+                _stride = ( ( points + lanes - 1 ) / lanes ) * lanes;
+                const std::size_t size = static_cast< std::size_t >( _components ) * _stride;
+                if ( size > _capacity ){
+                    if ( _data ){
+                        ::operator delete( _data, std::align_val_t( alignment ) );
+                    }
+                    _data = static_cast< T* >( ::operator new( size * sizeof( T ), std::align_val_t( alignment ) ) );
+                    _capacity = size;
+                }
+            }
+
+            void padLanes( ){
+                /*!
+                 * Fill the padded lanes of every component with the component's last point value
+                 */
+                if ( _points == 0 ){
+                    return;
+                }
+                for ( int component = 0; component < _components; component++ ){
+                    T *row = this->component( component );
+                    for ( int point = _points; point < _stride; point++ ){
+                        row[ point ] = row[ _points - 1 ];
+                    }
+                }
+            }
+
+            T *component( const int &index ){
+                /*!
+                 * Get the row of a component
+                 *
+                 * \param &index: The component index
+                 */
+                return _data + static_cast< std::size_t >( index ) * _stride;
+            }
+
+            const T *component( const int &index ) const{
+                /*!
+                 * Get the row of a component
+                 *
+                 * \param &index: The component index
+                 */
+                return _data + static_cast< std::size_t >( index ) * _stride;
+            }
+
+            T *data( ){ return _data; }
+
+            const T *data( ) const{ return _data; }
+
+            int components( ) const{ return _components; }
+
+            int points( ) const{ return _points; }
+
+            int stride( ) const{ return _stride; }
+
+        private:
+
+            T *_data;
+            std::size_t _capacity;
+            int _components;
+            int _points;
+            int _stride;
 
-        return vector_expansion;
-    }
+    };
 
     template< typename T >
-    inline std::vector< T > contractAbaqusNTENSVector( const std::vector< T > &full_abaqus_vector,
-                                                       const int &NDI, const int &NSHR ){
+    inline void packNTENSBlock( const int &nblock, const int &NDI, const int &NSHR, const T *block, SoABuffer< T > &soa,
+                                const bool abaqus_standard ){
         /*!
-         * Contract stress and strain type components from full Abaqus vectors.
-         *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
-         *
-         * The stress vector components for Abaqus/Standard (UMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         * Pack a column-major (nblock, NDI + NSHR) stress-type block, e.g. the VUMAT ``stressOld`` or ``strainInc``,
+         * into a 6 component SoA buffer. The SoA components are the full length 6 Abaqus vector of the same solver
+         * ordering and the components omitted by NDI and NSHR are zero, so kernels are always written in 3D.
          *
-         * The stress vector components for Abaqus/Explicit (VUMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
-         *
-         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
-         * engineering shear strain where
-         *
-         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
-         *
-         * for both Abaqus/Standard and Abaqus/Explicit.
-         *
-         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \param &nblock: The number of points in the block. The leading dimension of the block array.
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
-         * \returns vector_contraction: c++ type vector of length NDI + NSHR.
+         * \param *block: The column-major stress-type block
+         * \param &soa: The output (6, nblock) SoA buffer
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Required, because blocks come from both the VUMAT and batched UMAT points.
          */
 
-        //Initialize contracted vector to the appropriate dimensions
-        std::vector< T > vector_contraction( NDI + NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( nblock >= 0, std::length_error, "nblock must be non-negative" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( block, nblock * ( NDI + NSHR ), "block" );
 
-        //Pack non-zero direct components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NDI; index++ ){
-            vector_contraction[ index ] = full_abaqus_vector[ index ];
+        soa.resize( 6, nblock );
+        for ( int component = 0; component < 6; component++ ){
+            std::fill( soa.component( component ), soa.component( component ) + nblock, T( 0 ) );
         }
-
-        //Pack non-zero shear components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NSHR; index++ ){
-            vector_contraction[ NDI + index ] = full_abaqus_vector[ 3 + index ];
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            std::copy( block + index * nblock, block + ( index + 1 ) * nblock,
+                       soa.component( abaqusComponentMap( NDI, NSHR, abaqus_standard ).contracted_to_full[ index ] ) );
         }
+        soa.padLanes( );
 
-        return vector_contraction;
+        return;
     }
 
     template< typename T >
-    inline std::vector< std::vector < T > > contractAbaqusNTENSMatrix( const std::vector< std::vector< T > > &full_abaqus_matrix,
-                                                                       const int &NDI, const int &NSHR ){
+    inline void unpackNTENSBlock( const SoABuffer< T > &soa, const int &nblock, const int &NDI, const int &NSHR, T *block,
+                                  const bool abaqus_standard ){
         /*!
-         * Contract NTENS type components from full Abaqus stress-type matrixes (6x6). ONLY APPLIES TO
-         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
-         *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
-         *
-         * The stress vector components for Abaqus/Standard (UMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
-         *
-         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The related matrixes are
-         * therefore ordered for Abaqus/Standard (UMAT) as
-         *
-         * TODO: Update LaTeX formatting for a well aligned matrix
-         *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * Unpack the NDI + NSHR components of a 6 component SoA buffer into a column-major (nblock, NDI + NSHR)
+         * stress-type block, e.g. the VUMAT ``stressNew``. See ``tardigradeAbaqusTools::packNTENSBlock``.
          *
-         * \param &full_abaqus_matrix: a previously expanded abaqus NTENS matrix. Dimensions 6x6.
+         * \param &soa: The (6, nblock) SoA buffer
+         * \param &nblock: The number of points in the block. The leading dimension of the block array.
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
-         * \returns matrix_contraction: c++ type vector of vectors with square shape of size NDI + NSHR.
+         * \param *block: The output column-major stress-type block
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Required. See ``tardigradeAbaqusTools::packNTENSBlock``.
          */
 
-        //Initialize contracted matrix to the appropriate dimensions
-        std::vector< std::vector< T > > matrix_contraction( NDI + NSHR, std::vector< T >( NDI + NSHR ) );
-
-        //Loop non-zero direct component rows
-        for ( int row = 0; row < NDI; row++ ){
-            //Loop non-zero direct component columns
-            for ( int col = 0; col < NDI; col++ ){
-                matrix_contraction[ row ][ col ] = full_abaqus_matrix[ row ][ col ];
-            }
-            //Loop non-zero shear component columns
-            for ( int col = 0; col < NSHR; col++ ){
-                matrix_contraction[ row ][ NDI + col ] = full_abaqus_matrix[ row ][ 3 + col ];
-            }
-        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == 6 ) && ( soa.points( ) >= nblock ), std::length_error,
+                                       "The SoA buffer must have 6 components and at least nblock points" );
 
-        //Loop non-zero shear component rows
-        for ( int row = 0; row < NSHR; row++ ){
-            //Loop non-zero direct component columns
-            for ( int col = 0; col < NDI; col++ ){
-                matrix_contraction[ NDI + row ][ col ] = full_abaqus_matrix[ 3 + row ][ col ];
-            }
-            //Loop non-zero shear component columns
-            for ( int col = 0; col < NSHR; col++ ){
-                matrix_contraction[ NDI + row ][ NDI + col ] = full_abaqus_matrix[ 3 + row ][ 3 + col ];
-            }
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            const T *row = soa.component( abaqusComponentMap( NDI, NSHR, abaqus_standard ).contracted_to_full[ index ] );
+            std::copy( row, row + nblock, block + index * nblock );
         }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( block, nblock * ( NDI + NSHR ), "block" );
 
-        return matrix_contraction;
+        return;
     }
 
     template< typename T >
-    inline std::vector< T > expandFullNTENSTensor( const std::vector< T > &long_vector,
-                                                   const bool abaqus_standard = true ){
+    inline void packNTENSPoint( const T *abaqus_vector, const int &NDI, const int &NSHR, const int &point,
+                                SoABuffer< T > &soa, const bool abaqus_standard = true ){
         /*!
-         * Expand the full 3x3 tensor as a row-major vector from the expanded Abaqus stress-type NTENS vector of
-         * length 6. Handle the stress-type vector element order differences between Abaqus/Standard and
-         * Abaqus/Explicit.
+         * Pack the stress-type vector of one point, e.g. the UMAT ``STRESS`` of an integration point, into lane
+         * ``point`` of a 6 component SoA buffer sized by the caller. Call ``SoABuffer::padLanes`` after packing the
+         * last point. See ``tardigradeAbaqusTools::packNTENSBlock`` for the SoA component ordering.
          *
-         * ``tardigradeAbaqusTools::expandAbaqusNTENSVector`` returns
-         *
-         * Abaqus/Standard (UMAT)
-         *
-         *     long_vector[]            0            1            2          3          4          5
-         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23}  }
-         *
-         * Abaqus/Explicit (VUMAT)
-         *
-         *     long_vector[]            0            1            2          3          4          5
-         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13}  }
-         *
-         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
+         * \param *abaqus_vector: The stress-type vector of length NDI + NSHR
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param &point: The SoA lane of the point
+         * \param &soa: The (6, points) SoA buffer
          * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
          *                         Default: True.
-         * \returns full_tensor: c++ type row major vector of length 9.
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 9 );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == 6 ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a 6 component SoA buffer" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( abaqus_vector, NDI + NSHR, "abaqus_vector" );
 
-        //Set the tensor packing order by Abaqus solver
-        if ( abaqus_standard ){
-            tensorOrder = { 0, 3, 4,
-                            3, 1, 5,
-                            4, 5, 2 };
-        }
-        else{
-            tensorOrder = { 0, 3, 5,
-                            3, 1, 4,
-                            5, 4, 2 };
+        const AbaqusComponentMap &full_map = abaqusComponentMap( 3, 3, abaqus_standard );
+        const AbaqusComponentMap &component_map = abaqusComponentMap( NDI, NSHR, abaqus_standard );
+        for ( int full_index = 0; full_index < 6; full_index++ ){
+            const int component = component_map.tensor_to_contracted[ full_map.contracted_to_tensor[ full_index ] ];
+            soa.component( full_index )[ point ] = ( component < 0 ) ? T( 0 ) : abaqus_vector[ component ];
         }
 
-        //Pack the row-major full tensor
-        std::vector< T > full_tensor = { long_vector[tensorOrder[0]], long_vector[tensorOrder[1]], long_vector[tensorOrder[2]],
-                                         long_vector[tensorOrder[3]], long_vector[tensorOrder[4]], long_vector[tensorOrder[5]],
-                                         long_vector[tensorOrder[6]], long_vector[tensorOrder[7]], long_vector[tensorOrder[8]] };
-
-        return full_tensor;
-
+        return;
     }
 
     template< typename T >
-    inline std::vector< T > expandFullNTENSTensor( const std::vector< T > &abaqus_vector,
-                                                   const int &NDI, const int &NSHR,
-                                                   const bool abaqus_standard = true ){
+    inline void unpackNTENSPoint( const SoABuffer< T > &soa, const int &point, const int &NDI, const int &NSHR,
+                                  T *abaqus_vector, const bool abaqus_standard = true ){
         /*!
-         * Expand the full 3x3 tensor as a row-major vector from the contracted Abaqus stress-type vector of length
-         * NDI + NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and
-         * Abaqus/Explicit.
+         * Unpack lane ``point`` of a 6 component SoA buffer into the stress-type vector of one point, e.g. the UMAT
+         * ``STRESS`` of an integration point. See ``tardigradeAbaqusTools::packNTENSBlock``.
          *
-         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &soa: The (6, points) SoA buffer
+         * \param &point: The SoA lane of the point
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
+         * \param *abaqus_vector: The output stress-type vector of length NDI + NSHR
          * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
          *                         Default: True.
-         * \returns full_tensor: c++ type row-major vector of length 9.
          */
 
-        //Expand the stress-type vector
-        std::vector< T > long_vector = tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR );
-
-        //Expand the full tensor
-        std::vector< T > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, abaqus_standard );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == 6 ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a 6 component SoA buffer" );
 
-        return full_tensor;
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            abaqus_vector[ index ] = soa.component( abaqusComponentMap( NDI, NSHR, abaqus_standard ).contracted_to_full[ index ] )[ point ];
+        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( abaqus_vector, NDI + NSHR, "abaqus_vector" );
 
+        return;
     }
 
     template< typename T >
-    inline std::vector< T > contractFullNTENSTensor( const std::vector< T > &full_tensor,
-                                                     const bool abaqus_standard = true ){
+    inline void packVUMATDeformationGradient( const int &nblock, const int &ndir, const int &nshr, const T *defgrad,
+                                              SoABuffer< T > &soa ){
         /*!
-         * Contract a full 3x3 tensor stored as a row-major vector into the full Abaqus stress-type vector of length 6.
-         * Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
-         *
-         * The full tensor is stored as a row-major vector
-         *
-         *     full_tensor[]            0            1            2
-         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
-         *
-         *     full_tensor[]            3            4            5
-         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
-         *
-         *     full_tensor[]            6            7            8
-         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
-         *
-         * \param full_tensor: c++ type row-major vector of length 9.
-         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
-         *                         Default: True.
-         * \returns &full_abaqus_vector: an expanded abaqus stress-type vector. Length 6.
+         * Pack a column-major (nblock, ndir + nshr + nshr) VUMAT deformation gradient block, e.g. ``defgradNew``,
+         * into a 9 component SoA buffer ordered as the row-major 3x3 tensor \f$ F_{11}, F_{12}, F_{13}, F_{21}, \ldots \f$.
+         * Components omitted by ndir and nshr are the identity. See ``tardigradeAbaqusTools::computeVUMATPointRotation``
+         * for the block component ordering.
+         *
+         * \param &nblock: The number of points in the block. The leading dimension of the block array.
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param *defgrad: The column-major deformation gradient block
+         * \param &soa: The output (9, nblock) SoA buffer
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 6 );
-        std::vector< T > full_abaqus_vector( 6 );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_NTENS( ndir, nshr );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( nblock >= 0, std::length_error, "nblock must be non-negative" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( defgrad, nblock * ( ndir + 2 * nshr ), "defgrad" );
 
-        //Set the tensor unpacking order by Abaqus solver
-        if ( abaqus_standard ){
-            tensorOrder = { 0, 4, 8, 1, 2, 5 };
+        soa.resize( 9, nblock );
+        for ( int index = 0; index < 9; index++ ){
+            std::fill( soa.component( index ), soa.component( index ) + nblock, T( index % 4 == 0 ) );
         }
-        else{
-            tensorOrder = { 0, 4, 8, 1, 5, 2 };
+        const AbaqusDeformationGradientMap &defgrad_map = abaqusDeformationGradientMap( ndir, nshr );
+        for ( unsigned int index = 0; index < defgrad_map.ncomponents; index++ ){
+            std::copy( defgrad + index * nblock, defgrad + ( index + 1 ) * nblock,
+                       soa.component( defgrad_map.component_to_tensor[ index ] ) );
         }
+        soa.padLanes( );
 
-        //Unpack the row-major full tensor
-        full_abaqus_vector = { full_tensor[tensorOrder[0]], full_tensor[tensorOrder[1]], full_tensor[tensorOrder[2]],
-                               full_tensor[tensorOrder[3]], full_tensor[tensorOrder[4]], full_tensor[tensorOrder[5]] };
+        return;
+    }
 
-        return full_abaqus_vector;
+    template< typename T >
+    inline void packUMATDeformationGradientPoint( const T *DFGRD, const int &point, SoABuffer< T > &soa ){
+        /*!
+         * Pack the column-major 3x3 UMAT deformation gradient of one point, e.g. ``DFGRD0`` or ``DFGRD1``, into lane
+         * ``point`` of a 9 component SoA buffer sized by the caller. The SoA components are ordered as the row-major
+         * 3x3 tensor, matching ``tardigradeAbaqusTools::packVUMATDeformationGradient``. Call ``SoABuffer::padLanes``
+         * after packing the last point.
+         *
+         * \param *DFGRD: The column-major 3x3 deformation gradient
+         * \param &point: The SoA lane of the point
+         * \param &soa: The (9, points) SoA buffer
+         */
 
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == 9 ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a 9 component SoA buffer" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( DFGRD, 9, "DFGRD" );
+
+        for ( int row = 0; row < 3; row++ ){
+            for ( int col = 0; col < 3; col++ ){
+                soa.component( 3 * row + col )[ point ] = DFGRD[ row + 3 * col ];
+            }
+        }
+
+        return;
     }
 
     template< typename T >
-    inline std::vector< T > contractFullNTENSTensor( const std::vector< T > &full_tensor,
-                                                     const int &NDI, const int &NSHR,
-                                                     const bool abaqus_standard = true ){
+    inline void unpackUMATDeformationGradientPoint( const SoABuffer< T > &soa, const int &point, T *DFGRD ){
         /*!
-         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector of length NDI +
-         * NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
-         *
-         * The full tensor is stored as a row-major vector
-         *
-         *     full_tensor[]            0            1            2
-         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
-         *
-         *     full_tensor[]            3            4            5
-         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
-         *
-         *     full_tensor[]            6            7            8
-         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         * Unpack lane ``point`` of a 9 component SoA buffer into a column-major 3x3 UMAT deformation gradient. See
+         * ``tardigradeAbaqusTools::packUMATDeformationGradientPoint``.
          *
-         * \param full_tensor: c++ type row-major vector of length 9.
-         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
-         *                         Default: True.
-         * \returns &abaqus_vector: a contracted abaqus stress-type vector. Length NDI + NSHR.
+         * \param &soa: The (9, points) SoA buffer
+         * \param &point: The SoA lane of the point
+         * \param *DFGRD: The output column-major 3x3 deformation gradient
          */
 
-        //Contract to full length (6) abaqus stress-type vector
-        std::vector< T > full_abaqus_vector = contractFullNTENSTensor( full_tensor, abaqus_standard );
-
-        //Contract the full length (6) vector to an abaqus stress-type vector of length NDI + NSHR
-        std::vector< T > abaqus_vector = contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == 9 ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a 9 component SoA buffer" );
 
-        return abaqus_vector;
+        for ( int row = 0; row < 3; row++ ){
+            for ( int col = 0; col < 3; col++ ){
+                DFGRD[ row + 3 * col ] = soa.component( 3 * row + col )[ point ];
+            }
+        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( DFGRD, 9, "DFGRD" );
 
+        return;
     }
 
     template< typename T >
-    inline std::vector< std::vector< T > > contractFullNTENSMatrix( const std::vector< std::vector< T > > &full_matrix){
+    inline void packStateBlock( const int &nblock, const int &nstatev, const T *state, SoABuffer< T > &soa ){
         /*!
-         * Re-pack a full 9x9 matrix into the expected order for an expanded (6x6) Abaqus NTENS matrix. ONLY APPLIES TO
-         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
-         *
-         * Full 9x9 Matrix
-         *
-         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
-         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
-         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
-         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
-         *
-         * Abaqus/Standard 6x6 Matrix
-         *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * Pack a column-major (nblock, nstatev) VUMAT state variable block, e.g. ``stateOld``, into a (nstatev, nblock)
+         * SoA buffer. For a single UMAT point nblock is 1 and the block is ``STATEV``.
          *
-         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
-         * \returns full_abaqus_matrix: Expanded 6x6 Voigt matrix with Abaqus/Standard element ordering.
+         * \param &nblock: The number of points in the block. The leading dimension of the block array.
+         * \param &nstatev: The number of state variables
+         * \param *state: The column-major state variable block
+         * \param &soa: The output (nstatev, nblock) SoA buffer
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 6 );
-        std::vector< std::vector< T > > full_abaqus_matrix( 6, std::vector< T >( 6 ) );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( nblock >= 0 ) && ( nstatev >= 0 ), std::length_error,
+                                       "nblock and nstatev must be non-negative" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( state, nblock * nstatev, "state" );
 
-        // abaqus/standard packing order
-        tensorOrder = { 0, 4, 8, 1, 2, 5 };
-
-        //Repack the full matrix for Abaqus
-        for ( unsigned int i = 0; i < tensorOrder.size( ); i++ ){
-            for ( unsigned int j = 0; j < tensorOrder.size( ); j++ ){
-                full_abaqus_matrix[ i ][ j ] = full_matrix[ tensorOrder[ i ] ][ tensorOrder[ j ] ];
-            }
+        soa.resize( nstatev, nblock );
+        for ( int index = 0; index < nstatev; index++ ){
+            std::copy( state + index * nblock, state + ( index + 1 ) * nblock, soa.component( index ) );
         }
+        soa.padLanes( );
 
-        return full_abaqus_matrix;
-
+        return;
     }
 
     template< typename T >
-    inline std::vector< std::vector < T > > contractFullNTENSMatrix( const std::vector< std::vector< T > > &full_matrix,
-                                                                     const int &NDI, const int &NSHR ){
+    inline void unpackStateBlock( const SoABuffer< T > &soa, const int &nblock, const int &nstatev, T *state ){
         /*!
-         * Re-pack a full 9x9 matrix into the expected order for the contracted (NTENSxNTENS) Abaqus NTENS matrix. ONLY
-         * APPLIES TO ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
-         *
-         * Full 9x9 Matrix
-         *
-         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
-         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
-         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
-         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
-         *
-         * Abaqus/Standard 6x6 Matrix
-         *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * Unpack a (nstatev, nblock) SoA buffer into a column-major (nblock, nstatev) VUMAT state variable block, e.g.
+         * ``stateNew``.
          *
-         * Where the output matrix from this function omits the by-definition zero valued components determined by NDI
-         * and NSHR.
-         *
-         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
-         * \param &NDI: The number of direct components.
-         * \param &NSHR: The number of shear components.
-         * \returns &abaqus_matrix: A contracted Abaqus Voigt matrix with dimensions NTENSxNTENS where NTENS = NDI +
-         *                          NSHR.
+         * \param &soa: The (nstatev, nblock) SoA buffer
+         * \param &nblock: The number of points in the block. The leading dimension of the block array.
+         * \param &nstatev: The number of state variables
+         * \param *state: The output column-major state variable block
          */
 
-        //Initialize internal vectors
-        std::vector< std::vector< T > > full_abaqus_matrix( 6, std::vector< T >( 6 ) );
-        std::vector< std::vector< T > > abaqus_matrix( NDI + NSHR, std::vector< T >( NDI + NSHR ) );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == nstatev ) && ( soa.points( ) >= nblock ), std::length_error,
+                                       "The SoA buffer must have nstatev components and at least nblock points" );
 
-        //Detruct to 6x6
-        full_abaqus_matrix = contractFullNTENSMatrix( full_matrix );
+        for ( int index = 0; index < nstatev; index++ ){
+            std::copy( soa.component( index ), soa.component( index ) + nblock, state + index * nblock );
+        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( state, nblock * nstatev, "state" );
 
-        //Contract to NTENSxNTENS
-        abaqus_matrix = contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR );
+        return;
+    }
 
-        return abaqus_matrix;
+    template< typename T >
+    inline void packStatePoint( const T *STATEV, const int &nstatev, const int &point, SoABuffer< T > &soa ){
+        /*!
+         * Pack the state variables of one point, e.g. the UMAT ``STATEV`` of an integration point, into lane ``point``
+         * of a (nstatev, points) SoA buffer sized by the caller. Call ``SoABuffer::padLanes`` after packing the last
+         * point.
+         *
+         * \param *STATEV: The state variables of the point
+         * \param &nstatev: The number of state variables
+         * \param &point: The SoA lane of the point
+         * \param &soa: The (nstatev, points) SoA buffer
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == nstatev ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a nstatev component SoA buffer" );
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( STATEV, nstatev, "STATEV" );
+
+        for ( int index = 0; index < nstatev; index++ ){
+            soa.component( index )[ point ] = STATEV[ index ];
+        }
+
+        return;
+    }
+
+    template< typename T >
+    inline void unpackStatePoint( const SoABuffer< T > &soa, const int &point, const int &nstatev, T *STATEV ){
+        /*!
+         * Unpack lane ``point`` of a (nstatev, points) SoA buffer into the state variables of one point, e.g. the UMAT
+         * ``STATEV`` of an integration point.
+         *
+         * \param &soa: The (nstatev, points) SoA buffer
+         * \param &point: The SoA lane of the point
+         * \param &nstatev: The number of state variables
+         * \param *STATEV: The output state variables of the point
+         */
 
+        TARDIGRADE_ABAQUS_TOOLS_CHECK( ( soa.components( ) == nstatev ) && ( point >= 0 ) && ( point < soa.points( ) ),
+                                       std::out_of_range, "The point must be a lane of a nstatev component SoA buffer" );
+
+        for ( int index = 0; index < nstatev; index++ ){
+            STATEV[ index ] = soa.component( index )[ point ];
+        }
+        TARDIGRADE_ABAQUS_TOOLS_CHECK_FINITE_ARRAY( STATEV, nstatev, "STATEV" );
+
+        return;
     }
 
 }
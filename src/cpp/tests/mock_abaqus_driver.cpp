@@ -0,0 +1,456 @@
+/**
+  ******************************************************************************
+  * \file mock_abaqus_driver.cpp
+  ******************************************************************************
+  * A local mock of the Abaqus solver for throughput testing of UMATs and VUMATs
+  * without an Abaqus installation. The driver calls the ``umat_`` or ``vumat_``
+  * symbol with the Fortran calling convention and memory layout used by
+  * Abaqus: column-major DDSDDE, (nblock, *) strided VUMAT arrays, and a blank
+  * padded CMNAME with its length passed as a trailing hidden argument.
+  *
+  * Each thread owns a contiguous range of synthetic material points and drives
+  * them through a prescribed strain path. The driver reports the material
+  * point update throughput and the per-call latency.
+  *
+  * Usage: mock_abaqus_driver [--subroutine umat|vumat] [--points N] [--increments N] [--threads N] [--nblock N]
+  *                           [--nshr N] [--path uniaxial|shear|cyclic]
+  ******************************************************************************
+  */
+
+#include<algorithm>
+#include<chrono>
+#include<cmath>
+#include<cstdlib>
+#include<iostream>
+#include<stdexcept>
+#include<string>
+#include<thread>
+#include<vector>
+
+#include"mock_abaqus_driver.h"
+
+namespace{
+
+    typedef std::chrono::steady_clock clock_type;
+
+    //! Every sample_stride calls are individually timed for the latency distribution
+    const long sample_stride = 64;
+
+    struct DriverOptions{
+        /*!
+         * The mock Abaqus driver command line options
+         */
+        std::string subroutine = "umat"; //!< The subroutine to call. One of umat, vumat
+        long points = 1000000;           //!< The number of synthetic material points
+        int increments = 10;             //!< The number of increments in the strain path
+        int threads = 1;                 //!< The number of solver threads
+        int nblock = 136;                //!< The maximum VUMAT block size
+        int nshr = 3;                    //!< The number of shear components. 3 for 3D, 1 for plane strain
+        std::string path = "cyclic";     //!< The prescribed strain path. One of uniaxial, shear, cyclic
+    };
+
+    struct ThreadResult{
+        /*!
+         * The timing results of a single solver thread
+         */
+        long calls = 0;                  //!< The number of subroutine calls
+        long cutbacks = 0;               //!< The number of UMAT calls that requested a time increment cutback
+        double seconds = 0.;             //!< The wall time spent in the thread's increment loops
+        double checksum = 0.;            //!< A checksum of the final stresses to keep the work observable
+        std::vector< double > samples;   //!< Individually timed call latencies in nanoseconds
+    };
+
+    void printUsage( ){
+        std::cerr << "Usage: mock_abaqus_driver [--subroutine umat|vumat] [--points N] [--increments N] [--threads N]"
+                  << " [--nblock N] [--nshr N] [--path uniaxial|shear|cyclic]" << std::endl;
+    }
+
+    DriverOptions parseOptions( int argc, char **argv ){
+        /*!
+         * Parse the driver command line options
+         *
+         * \param argc: The number of command line arguments
+         * \param **argv: The command line arguments
+         * \returns options: The driver options
+         */
+
+        DriverOptions options;
+        options.threads = std::max( 1, static_cast< int >( std::thread::hardware_concurrency( ) ) );
+        for ( int index = 1; index < argc; index++ ){
+            const std::string flag = argv[ index ];
+            if ( index + 1 >= argc ){
+                throw std::invalid_argument( "Missing value for option '" + flag + "'" );
+            }
+            const std::string value = argv[ ++index ];
+            if ( flag == "--subroutine" ){
+                options.subroutine = value;
+            }
+            else if ( flag == "--points" ){
+                options.points = std::stol( value );
+            }
+            else if ( flag == "--increments" ){
+                options.increments = std::stoi( value );
+            }
+            else if ( flag == "--threads" ){
+                options.threads = std::stoi( value );
+            }
+            else if ( flag == "--nblock" ){
+                options.nblock = std::stoi( value );
+            }
+            else if ( flag == "--nshr" ){
+                options.nshr = std::stoi( value );
+            }
+            else if ( flag == "--path" ){
+                options.path = value;
+            }
+            else{
+                throw std::invalid_argument( "Unknown option '" + flag + "'" );
+            }
+        }
+
+        if ( options.subroutine != "umat" && options.subroutine != "vumat" ){
+            throw std::invalid_argument( "The subroutine must be one of umat, vumat" );
+        }
+        if ( options.path != "uniaxial" && options.path != "shear" && options.path != "cyclic" ){
+            throw std::invalid_argument( "The strain path must be one of uniaxial, shear, cyclic" );
+        }
+        if ( options.nshr != 1 && options.nshr != 3 ){
+            throw std::invalid_argument( "The number of shear components must be 1 or 3" );
+        }
+        if ( options.points < 1 || options.increments < 1 || options.threads < 1 || options.nblock < 1 ){
+            throw std::invalid_argument( "The points, increments, threads, and nblock must be positive" );
+        }
+        options.threads = static_cast< int >( std::min( static_cast< long >( options.threads ), options.points ) );
+
+        return options;
+    }
+
+    void strainPath( const DriverOptions &options, const int &increment, const long &point, const int &ntens,
+                     double *strain ){
+        /*!
+         * Evaluate the prescribed total strain of a material point at the end of an increment. Shear components are
+         * tensorial.
+         *
+         * \param &options: The driver options
+         * \param &increment: The increment number starting from one
+         * \param &point: The global material point number
+         * \param &ntens: The number of stress-type components
+         * \param *strain: The output strain of length ntens
+         */
+
+        const double amplitude = 1.e-3 * ( 1. + 1.e-3 * static_cast< double >( point % 17 ) );
+        const double time = static_cast< double >( increment ) / static_cast< double >( options.increments );
+        double load = amplitude * time;
+        if ( options.path == "cyclic" ){
+            load = amplitude * std::sin( 2. * M_PI * time );
+        }
+
+        std::fill( strain, strain + ntens, 0. );
+        if ( options.path == "shear" ){
+            strain[ 3 ] = load;
+        }
+        else{
+            strain[ 0 ] = load;
+            strain[ 1 ] = -0.3 * load;
+            strain[ 2 ] = -0.3 * load;
+            strain[ 3 ] = 0.1 * load;
+        }
+    }
+
+    std::vector< char > blankPaddedName( const std::string &name ){
+        /*!
+         * Create a blank padded Fortran CHARACTER*80 material name
+         *
+         * \param &name: The material name
+         * \returns fortran_name: The blank padded character array without null termination
+         */
+        std::vector< char > fortran_name( CMNAME_LENGTH, ' ' );
+        std::copy( name.begin( ), name.begin( ) + std::min( name.size( ), fortran_name.size( ) ), fortran_name.begin( ) );
+        return fortran_name;
+    }
+
+    void runUMAT( const DriverOptions &options, const long first_point, const long last_point, ThreadResult &result ){
+        /*!
+         * Drive the UMAT for a range of material points. Each material point owns its own stress, strain and state
+         * variable storage.
+         *
+         * \param &options: The driver options
+         * \param first_point: The first global material point owned by the thread
+         * \param last_point: One past the last global material point owned by the thread
+         * \param &result: The thread timing results
+         */
+
+        const int NDI = 3;
+        const int NSHR = options.nshr;
+        const int NTENS = NDI + NSHR;
+        const int NSTATV = 1;
+        const int NPROPS = 2;
+        const long npoints = last_point - first_point;
+
+        //Synthetic material point storage
+        std::vector< double > stress( npoints * NTENS, 0. );
+        std::vector< double > strain( npoints * NTENS, 0. );
+        std::vector< double > statev( npoints * NSTATV, 0. );
+
+        //Per-call Abaqus arguments
+        const std::vector< char > CMNAME = blankPaddedName( "MOCK_ELASTIC" );
+        const std::vector< double > PROPS = { 200.e3, 0.3 };
+        std::vector< double > DDSDDE( NTENS * NTENS );
+        std::vector< double > DDSDDT( NTENS ), DRPLDE( NTENS );
+        std::vector< double > DSTRAN( NTENS ), target( NTENS );
+        double SSE = 0., SPD = 0., SCD = 0., RPL = 0., DRPLDT = 0., PNEWDT = 1.;
+        double TIME[ 2 ] = { 0., 0. };
+        const double DTIME = 1. / static_cast< double >( options.increments );
+        const double TEMP = 293., DTEMP = 0., CELENT = 1.;
+        const double PREDEF[ 1 ] = { 0. }, DPRED[ 1 ] = { 0. };
+        const double COORDS[ 3 ] = { 0., 0., 0. };
+        const double DROT[ 9 ] = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+        const double DFGRD0[ 9 ] = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+        const double DFGRD1[ 9 ] = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+        const int LAYER = 1, KSPT = 1;
+        const int JSTEP[ 4 ] = { 1, 1, 0, 0 };
+
+        result.samples.reserve( ( npoints * options.increments ) / sample_stride + 1 );
+        const clock_type::time_point start = clock_type::now( );
+        for ( int KINC = 1; KINC <= options.increments; KINC++ ){
+            TIME[ 0 ] = ( KINC - 1 ) * DTIME;
+            TIME[ 1 ] = ( KINC - 1 ) * DTIME;
+            for ( long point = 0; point < npoints; point++ ){
+                const long global_point = first_point + point;
+                double *STRESS = stress.data( ) + point * NTENS;
+                double *STRAN  = strain.data( ) + point * NTENS;
+
+                //Engineering shear strain increment toward the prescribed path
+                strainPath( options, KINC, global_point, NTENS, target.data( ) );
+                for ( int component = 0; component < NTENS; component++ ){
+                    const double shear_factor = ( component < NDI ) ? 1. : 2.;
+                    DSTRAN[ component ] = shear_factor * target[ component ] - STRAN[ component ];
+                }
+
+                const int NOEL = static_cast< int >( global_point / 8 + 1 );
+                const int NPT = static_cast< int >( global_point % 8 + 1 );
+                const bool sample = ( result.calls % sample_stride ) == 0;
+                const clock_type::time_point call_start = sample ? clock_type::now( ) : clock_type::time_point( );
+                umat_( STRESS, statev.data( ) + point * NSTATV, DDSDDE.data( ), SSE, SPD, SCD, RPL, DDSDDT.data( ),
+                       DRPLDE.data( ), DRPLDT, STRAN, DSTRAN.data( ), TIME, DTIME, TEMP, DTEMP, PREDEF, DPRED,
+                       CMNAME.data( ), NDI, NSHR, NTENS, NSTATV, PROPS.data( ), NPROPS, COORDS, DROT, PNEWDT, CELENT,
+                       DFGRD0, DFGRD1, NOEL, NPT, LAYER, KSPT, JSTEP, KINC, CMNAME_LENGTH );
+                if ( sample ){
+                    result.samples.push_back(
+                        std::chrono::duration< double, std::nano >( clock_type::now( ) - call_start ).count( ) );
+                }
+                result.calls++;
+                if ( PNEWDT < 1. ){
+                    result.cutbacks++;
+                    PNEWDT = 1.;
+                }
+
+                //Abaqus updates the total strain after a converged increment
+                for ( int component = 0; component < NTENS; component++ ){
+                    STRAN[ component ] += DSTRAN[ component ];
+                }
+            }
+        }
+        result.seconds = std::chrono::duration< double >( clock_type::now( ) - start ).count( );
+
+        for ( const double &value : stress ){
+            result.checksum += value;
+        }
+    }
+
+    void runVUMAT( const DriverOptions &options, const long first_point, const long last_point, ThreadResult &result ){
+        /*!
+         * Drive the VUMAT for a range of material points. The material points are partitioned into blocks of at most
+         * nblock points and every block array is stored as a column-major (nblock, ncomponents) array.
+         *
+         * \param &options: The driver options
+         * \param first_point: The first global material point owned by the thread
+         * \param last_point: One past the last global material point owned by the thread
+         * \param &result: The thread timing results
+         */
+
+        const int ndir = 3;
+        const int nshr = options.nshr;
+        const int ntens = ndir + nshr;
+        const int ndefgrad = ndir + nshr + nshr;
+        const int nstatev = 1;
+        const int nfieldv = 0;
+        const int nprops = 2;
+        const int lanneal = 0;
+        const long npoints = last_point - first_point;
+        const long nblocks = ( npoints + options.nblock - 1 ) / options.nblock;
+        const long block_size = options.nblock;
+
+        //Synthetic material point storage. Each block occupies block_size rows so block arrays stay nblock-strided.
+        std::vector< double > stress_old( nblocks * block_size * ntens, 0. ), stress_new( stress_old.size( ), 0. );
+        std::vector< double > state_old( nblocks * block_size * nstatev, 0. ), state_new( state_old.size( ), 0. );
+        std::vector< double > energy_old( nblocks * block_size, 0. ), energy_new( energy_old.size( ), 0. );
+        std::vector< double > inelastic_old( energy_old.size( ), 0. ), inelastic_new( energy_old.size( ), 0. );
+        std::vector< double > strain( nblocks * block_size * ntens, 0. );
+
+        //Per-call Abaqus arguments
+        const std::vector< char > cmname = blankPaddedName( "MOCK_ELASTIC" );
+        const std::vector< double > props = { 200.e3, 0.3 };
+        const std::vector< double > coordMp( block_size * 3, 0. );
+        const std::vector< double > charLength( block_size, 1. );
+        const std::vector< double > density( block_size, 7.8e-9 );
+        const std::vector< double > relSpinInc( block_size * nshr, 0. );
+        const std::vector< double > temperature( block_size, 293. );
+        const std::vector< double > field( 1, 0. );
+        std::vector< double > strainInc( block_size * ntens );
+        std::vector< double > stretchOld( block_size * ntens ), stretchNew( block_size * ntens );
+        std::vector< double > defgradOld( block_size * ndefgrad ), defgradNew( block_size * ndefgrad );
+        std::vector< double > target( ntens );
+        const double dt = 1. / static_cast< double >( options.increments );
+
+        result.samples.reserve( ( nblocks * options.increments ) / sample_stride + 1 );
+        const clock_type::time_point start = clock_type::now( );
+        for ( int increment = 1; increment <= options.increments; increment++ ){
+            const double stepTime = ( increment - 1 ) * dt;
+            for ( long block = 0; block < nblocks; block++ ){
+                const int nblock = static_cast< int >( std::min( block_size, npoints - block * block_size ) );
+                const long offset = block * block_size;
+
+                //Assemble the nblock-strided strain increment, stretch and deformation gradient blocks
+                for ( int point = 0; point < nblock; point++ ){
+                    double *total_strain = strain.data( ) + ( offset + point ) * ntens;
+                    strainPath( options, increment, first_point + offset + point, ntens, target.data( ) );
+                    for ( int component = 0; component < ntens; component++ ){
+                        strainInc[ component * nblock + point ] = target[ component ] - total_strain[ component ];
+                        const double identity = ( component < ndir ) ? 1. : 0.;
+                        stretchOld[ component * nblock + point ] = identity + total_strain[ component ];
+                        stretchNew[ component * nblock + point ] = identity + target[ component ];
+                        total_strain[ component ] = target[ component ];
+                    }
+                    //Symmetric stretch with no rotation. The deformation gradient shear components are ordered as
+                    //12, 23, 31, 21, 32, 13 in 3D and 12, 21 in 2D so both halves repeat the stretch shear components.
+                    for ( int component = 0; component < ndefgrad; component++ ){
+                        const int stretch_component = ( component < ntens ) ? component : component - nshr;
+                        defgradOld[ component * nblock + point ] = stretchOld[ stretch_component * nblock + point ];
+                        defgradNew[ component * nblock + point ] = stretchNew[ stretch_component * nblock + point ];
+                    }
+                }
+
+                const bool sample = ( result.calls % sample_stride ) == 0;
+                const clock_type::time_point call_start = sample ? clock_type::now( ) : clock_type::time_point( );
+                vumat_( nblock, ndir, nshr, nstatev, nfieldv, nprops, lanneal, stepTime, stepTime, dt, cmname.data( ),
+                        coordMp.data( ), charLength.data( ), props.data( ), density.data( ), strainInc.data( ),
+                        relSpinInc.data( ), temperature.data( ), stretchOld.data( ), defgradOld.data( ), field.data( ),
+                        stress_old.data( ) + offset * ntens, state_old.data( ) + offset * nstatev,
+                        energy_old.data( ) + offset, inelastic_old.data( ) + offset, temperature.data( ),
+                        stretchNew.data( ), defgradNew.data( ), field.data( ), stress_new.data( ) + offset * ntens,
+                        state_new.data( ) + offset * nstatev, energy_new.data( ) + offset,
+                        inelastic_new.data( ) + offset, CMNAME_LENGTH );
+                if ( sample ){
+                    result.samples.push_back(
+                        std::chrono::duration< double, std::nano >( clock_type::now( ) - call_start ).count( ) );
+                }
+                result.calls++;
+            }
+
+            //Abaqus/Explicit swaps the old and new state between increments
+            stress_old.swap( stress_new );
+            state_old.swap( state_new );
+            energy_old.swap( energy_new );
+            inelastic_old.swap( inelastic_new );
+        }
+        result.seconds = std::chrono::duration< double >( clock_type::now( ) - start ).count( );
+
+        for ( const double &value : stress_old ){
+            result.checksum += value;
+        }
+    }
+
+    double percentile( std::vector< double > &samples, const double fraction ){
+        /*!
+         * Compute a percentile of the sampled latencies
+         *
+         * \param &samples: The latency samples. Partially sorted in place.
+         * \param fraction: The percentile as a fraction in [0, 1]
+         * \returns value: The sample value at the requested percentile
+         */
+        if ( samples.empty( ) ){
+            return 0.;
+        }
+        const std::size_t index = std::min( samples.size( ) - 1,
+                                            static_cast< std::size_t >( fraction * static_cast< double >( samples.size( ) ) ) );
+        std::nth_element( samples.begin( ), samples.begin( ) + index, samples.end( ) );
+        return samples[ index ];
+    }
+
+}
+
+int main( int argc, char **argv ){
+
+    DriverOptions options;
+    try{
+        options = parseOptions( argc, argv );
+    }
+    catch( std::exception &error ){
+        std::cerr << "ERROR: " << error.what( ) << std::endl;
+        printUsage( );
+        return 1;
+    }
+
+    //Partition the material points into contiguous per-thread ranges
+    std::vector< ThreadResult > results( options.threads );
+    std::vector< std::thread > threads;
+    const clock_type::time_point start = clock_type::now( );
+    for ( int thread = 0; thread < options.threads; thread++ ){
+        const long first_point = ( options.points * thread ) / options.threads;
+        const long last_point = ( options.points * ( thread + 1 ) ) / options.threads;
+        if ( options.subroutine == "umat" ){
+            threads.emplace_back( runUMAT, std::cref( options ), first_point, last_point, std::ref( results[ thread ] ) );
+        }
+        else{
+            threads.emplace_back( runVUMAT, std::cref( options ), first_point, last_point, std::ref( results[ thread ] ) );
+        }
+    }
+    for ( std::thread &thread : threads ){
+        thread.join( );
+    }
+    const double wall_seconds = std::chrono::duration< double >( clock_type::now( ) - start ).count( );
+
+    //Reduce the thread results
+    long calls = 0;
+    long cutbacks = 0;
+    double thread_seconds = 0.;
+    double checksum = 0.;
+    std::vector< double > samples;
+    for ( ThreadResult &result : results ){
+        calls += result.calls;
+        cutbacks += result.cutbacks;
+        thread_seconds += result.seconds;
+        checksum += result.checksum;
+        samples.insert( samples.end( ), result.samples.begin( ), result.samples.end( ) );
+    }
+    const double updates = static_cast< double >( options.points ) * static_cast< double >( options.increments );
+    const double mean_latency = 1.e9 * thread_seconds / static_cast< double >( calls );
+
+    std::cout << "subroutine:                    " << options.subroutine << "\n"
+              << "strain path:                   " << options.path << "\n"
+              << "threads:                       " << options.threads << "\n"
+              << "material points:               " << options.points << "\n"
+              << "increments:                    " << options.increments << "\n"
+              << "subroutine calls:              " << calls << "\n"
+              << "wall time (s):                 " << wall_seconds << "\n"
+              << "points per second:             " << updates / wall_seconds << "\n"
+              << "mean latency per call (ns):    " << mean_latency << "\n"
+              << "mean latency per point (ns):   " << 1.e9 * thread_seconds / updates << "\n"
+              << "sampled latency p50 (ns):      " << percentile( samples, 0.50 ) << "\n"
+              << "sampled latency p99 (ns):      " << percentile( samples, 0.99 ) << "\n"
+              << "sampled latency max (ns):      " << percentile( samples, 1.00 ) << "\n"
+              << "stress checksum:               " << checksum << std::endl;
+
+    if ( cutbacks > 0 ){
+        std::cerr << "ERROR: The material subroutine requested " << cutbacks << " time increment cutback(s)" << std::endl;
+        return 1;
+    }
+
+    if ( !std::isfinite( checksum ) ){
+        std::cerr << "ERROR: The material subroutine returned non-finite stresses" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
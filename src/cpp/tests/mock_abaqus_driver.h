@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * \file mock_abaqus_driver.h
+  ******************************************************************************
+  * Fortran calling convention declarations for the Abaqus UMAT and VUMAT
+  * subroutines called by the mock Abaqus driver. All arguments are passed by
+  * reference and the length of the CMNAME character array is passed by value
+  * as a trailing hidden argument, matching the Intel Fortran compiler used by
+  * Abaqus on Linux.
+  ******************************************************************************
+  */
+
+#ifndef MOCK_ABAQUS_DRIVER_H
+#define MOCK_ABAQUS_DRIVER_H
+
+//! The fixed length of the Abaqus CMNAME character array
+const int CMNAME_LENGTH = 80;
+
+extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                       double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                       const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                       const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                       const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                       const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                       const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                       const int *JSTEP,     const int &KINC,      const int CMNAME_length ) noexcept;
+
+extern "C" void vumat_( const int &nblock,           const int &ndir,               const int &nshr,
+                        const int &nstatev,          const int &nfieldv,            const int &nprops,
+                        const int &lanneal,          const double &stepTime,        const double &totalTime,
+                        const double &dt,            const char *cmname,            const double *coordMp,
+                        const double *charLength,    const double *props,           const double *density,
+                        const double *strainInc,     const double *relSpinInc,      const double *tempOld,
+                        const double *stretchOld,    const double *defgradOld,      const double *fieldOld,
+                        const double *stressOld,     const double *stateOld,        const double *enerInternOld,
+                        const double *enerInelasOld, const double *tempNew,         const double *stretchNew,
+                        const double *defgradNew,    const double *fieldNew,        double *stressNew,
+                        double *stateNew,            double *enerInternNew,         double *enerInelasNew,
+                        const int cmname_length ) noexcept;
+
+#endif
@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * \file mock_abaqus_material.cpp
+  ******************************************************************************
+  * Default isotropic linear elastic UMAT and VUMAT used by the mock Abaqus
+  * driver. The material is written against the allocation free tardigrade
+  * abaqus tools pointer kernels and the material parameter cache, so the
+  * driver measures the conversion-plus-kernel cost of a C++ material
+  * subroutine rather than the heap.
+  *
+  * Material properties: PROPS = { Young's modulus, Poisson's ratio }
+  ******************************************************************************
+  */
+
+#include<cstdlib>
+#include<exception>
+#include<iostream>
+#include<stdexcept>
+
+#include<tardigrade_abaqus_tools.h>
+
+#include"mock_abaqus_driver.h"
+
+namespace{
+
+    struct ElasticParameters{
+        /*!
+         * The parsed isotropic linear elastic parameters and the constant elastic Jacobian. Parsed once per material
+         * name and PROPS contents by ``tardigradeAbaqusTools::MaterialParameterCache``.
+         */
+
+        ElasticParameters( const double *PROPS, const int &NPROPS ){
+            /*!
+             * \param *PROPS: The material properties { Young's modulus, Poisson's ratio }
+             * \param &NPROPS: The number of material properties
+             */
+
+            if ( NPROPS < 2 ){
+                throw std::invalid_argument( "The mock material requires PROPS = { Young's modulus, Poisson's ratio }" );
+            }
+
+            const double youngs_modulus = PROPS[ 0 ];
+            const double poisson_ratio  = PROPS[ 1 ];
+            lambda = youngs_modulus * poisson_ratio / ( ( 1. + poisson_ratio ) * ( 1. - 2. * poisson_ratio ) );
+            mu = youngs_modulus / ( 2. * ( 1. + poisson_ratio ) );
+
+            //Row-major 9x9 tangent of the row-major stress with respect to the row-major tensorial strain
+            for ( unsigned int i = 0; i < 3; i++ ){
+                for ( unsigned int j = 0; j < 3; j++ ){
+                    for ( unsigned int k = 0; k < 3; k++ ){
+                        for ( unsigned int l = 0; l < 3; l++ ){
+                            jacobian[ 9 * ( 3 * i + j ) + 3 * k + l ] = lambda * ( i == j ) * ( k == l )
+                                                                      + mu * ( ( i == k ) * ( j == l ) + ( i == l ) * ( j == k ) );
+                        }
+                    }
+                }
+            }
+        }
+
+        double lambda;          //!< The first Lame parameter
+        double mu;              //!< The shear modulus
+        double jacobian[ 81 ];  //!< The row-major 9x9 elastic Jacobian
+    };
+
+    const ElasticParameters &elasticParameters( const char *CMNAME, const int &CMNAME_length, const double *PROPS,
+                                                const int &NPROPS ){
+        /*!
+         * Get the cached parameters of a material as a real UMAT would for material dispatch
+         *
+         * \param *CMNAME: The blank padded Fortran material name
+         * \param &CMNAME_length: The length of the Fortran material name
+         * \param *PROPS: The material properties
+         * \param &NPROPS: The number of material properties
+         */
+        static tardigradeAbaqusTools::MaterialParameterCache< ElasticParameters > cache;
+        return cache.get( CMNAME, CMNAME_length, PROPS, NPROPS );
+    }
+
+    void linearElasticStress( const double *strain, const double &lambda, const double &mu, double *stress ){
+        /*!
+         * Compute the row-major 3x3 stress from the row-major 3x3 tensorial strain
+         *
+         * \param *strain: The row-major strain tensor of length 9
+         * \param &lambda: The first Lame parameter
+         * \param &mu: The shear modulus
+         * \param *stress: The output row-major stress tensor of length 9
+         */
+
+        const double trace = strain[ 0 ] + strain[ 4 ] + strain[ 8 ];
+        for ( unsigned int index = 0; index < 9; index++ ){
+            stress[ index ] = 2. * mu * strain[ index ];
+        }
+        stress[ 0 ] += lambda * trace;
+        stress[ 4 ] += lambda * trace;
+        stress[ 8 ] += lambda * trace;
+    }
+
+    [[noreturn]] void stopAnalysis( const char *subroutine, const char *message ){
+        /*!
+         * Report a material error and terminate the analysis. Stands in for the Abaqus ``XIT`` and ``XPLB_EXIT``
+         * utility routines, so no exception unwinds into the Fortran frames of the solver.
+         *
+         * \param *subroutine: The name of the material subroutine
+         * \param *message: The error message
+         */
+        std::cerr << "ERROR: " << subroutine << ": " << message << std::endl;
+        std::abort( );
+    }
+
+}
+
+extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                       double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                       const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                       const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                       const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                       const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                       const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                       const int *JSTEP,     const int &KINC,      const int CMNAME_length ) noexcept{
+    /*!
+     * Isotropic linear elastic Abaqus/Standard UMAT. Errors are reported and request a time increment cutback
+     * through PNEWDT; no exception leaves the subroutine.
+     */
+
+    tardigradeAbaqusTools::CheckContextScope check_context( NOEL, NPT );
+
+    try{
+        const ElasticParameters &parameters = elasticParameters( CMNAME, CMNAME_length, PROPS, NPROPS );
+
+        //Total strain at the end of the increment with engineering shear strains
+        double strain[ 6 ];
+        for ( int index = 0; index < NTENS; index++ ){
+            strain[ index ] = STRAN[ index ] + DSTRAN[ index ];
+        }
+
+        //Expand to the full tensorial strain
+        double strain_tensor[ 9 ];
+        tardigradeAbaqusTools::expandFullNTENSTensor( strain, NDI, NSHR, strain_tensor );
+        for ( unsigned int index : { 1, 2, 3, 5, 6, 7 } ){
+            strain_tensor[ index ] *= 0.5;
+        }
+
+        //Compute and pack the stress and the Jacobian
+        double stress_tensor[ 9 ];
+        linearElasticStress( strain_tensor, parameters.lambda, parameters.mu, stress_tensor );
+        tardigradeAbaqusTools::contractFullNTENSTensor( stress_tensor, NDI, NSHR, STRESS );
+        tardigradeAbaqusTools::contractFullNTENSMatrix( parameters.jacobian, NDI, NSHR, DDSDDE );
+
+        //Elastic strain energy density
+        SSE = 0.;
+        for ( int index = 0; index < NTENS; index++ ){
+            SSE += 0.5 * STRESS[ index ] * strain[ index ];
+        }
+        if ( NSTATV > 0 ){
+            STATEV[ 0 ] = SSE;
+        }
+    }
+    catch( std::exception &error ){
+        std::cerr << "ERROR: umat_ at NOEL " << NOEL << ", NPT " << NPT << ": " << error.what( ) << std::endl;
+        PNEWDT = 0.25;
+    }
+    catch( ... ){
+        std::cerr << "ERROR: umat_ at NOEL " << NOEL << ", NPT " << NPT << ": unknown error" << std::endl;
+        PNEWDT = 0.25;
+    }
+
+    return;
+}
+
+extern "C" void vumat_( const int &nblock,           const int &ndir,               const int &nshr,
+                        const int &nstatev,          const int &nfieldv,            const int &nprops,
+                        const int &lanneal,          const double &stepTime,        const double &totalTime,
+                        const double &dt,            const char *cmname,            const double *coordMp,
+                        const double *charLength,    const double *props,           const double *density,
+                        const double *strainInc,     const double *relSpinInc,      const double *tempOld,
+                        const double *stretchOld,    const double *defgradOld,      const double *fieldOld,
+                        const double *stressOld,     const double *stateOld,        const double *enerInternOld,
+                        const double *enerInelasOld, const double *tempNew,         const double *stretchNew,
+                        const double *defgradNew,    const double *fieldNew,        double *stressNew,
+                        double *stateNew,            double *enerInternNew,         double *enerInelasNew,
+                        const int cmname_length ) noexcept{
+    /*!
+     * Isotropic linear elastic Abaqus/Explicit VUMAT. Stress and strain blocks are (nblock, ndir + nshr) column-major
+     * arrays in the corotational frame with tensorial shear strains. Errors stop the analysis; no exception leaves the
+     * subroutine.
+     */
+
+    try{
+        const ElasticParameters &parameters = elasticParameters( cmname, cmname_length, props, nprops );
+
+        const int ntens = ndir + nshr;
+        double strain_increment[ 6 ];
+        double stress_old[ 6 ];
+        double stress_new[ 6 ];
+        double strain_tensor[ 9 ];
+        double stress_tensor[ 9 ];
+        double stress_increment[ 9 ];
+        for ( int point = 0; point < nblock; point++ ){
+
+            //Gather the nblock-strided point values
+            for ( int component = 0; component < ntens; component++ ){
+                strain_increment[ component ] = strainInc[ component * nblock + point ];
+                stress_old[ component ] = stressOld[ component * nblock + point ];
+            }
+
+            //Explicit stress-type vector ordering
+            tardigradeAbaqusTools::expandFullNTENSTensor( strain_increment, ndir, nshr, strain_tensor, false );
+            tardigradeAbaqusTools::expandFullNTENSTensor( stress_old, ndir, nshr, stress_tensor, false );
+            linearElasticStress( strain_tensor, parameters.lambda, parameters.mu, stress_increment );
+            for ( unsigned int index = 0; index < 9; index++ ){
+                stress_tensor[ index ] += stress_increment[ index ];
+            }
+            tardigradeAbaqusTools::contractFullNTENSTensor( stress_tensor, ndir, nshr, stress_new, false );
+
+            //Scatter the nblock-strided point values
+            double energy_increment = 0.;
+            for ( int component = 0; component < ntens; component++ ){
+                stressNew[ component * nblock + point ] = stress_new[ component ];
+                const double shear_factor = ( component < ndir ) ? 1. : 2.;
+                energy_increment += 0.5 * shear_factor * ( stress_old[ component ] + stress_new[ component ] )
+                                  * strain_increment[ component ];
+            }
+            enerInternNew[ point ] = enerInternOld[ point ] + energy_increment / density[ point ];
+            enerInelasNew[ point ] = enerInelasOld[ point ];
+            for ( int state = 0; state < nstatev; state++ ){
+                stateNew[ state * nblock + point ] = stateOld[ state * nblock + point ];
+            }
+        }
+    }
+    catch( std::exception &error ){
+        stopAnalysis( "vumat_", error.what( ) );
+    }
+    catch( ... ){
+        stopAnalysis( "vumat_", "unknown error" );
+    }
+
+    return;
+}
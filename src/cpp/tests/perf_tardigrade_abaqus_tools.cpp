@@ -0,0 +1,645 @@
+/**
+  ******************************************************************************
+  * \file perf_tardigrade_abaqus_tools.cpp
+  ******************************************************************************
+  * Performance regression suite for the abaqus tools conversion functions and
+  * the batched and UMAT-level paths built on them. Every workload is run for a
+  * fixed number of calls and compared against a stored baseline file:
+  *
+  * - heap allocations per call, counted by replacing the global operator new,
+  *   must not exceed the baseline by more than the allocation tolerance
+  * - workloads with a reference workload, e.g. a vectorized block kernel and
+  *   the point by point path it replaces, must be faster than the reference
+  *   measured in the same run by a minimum ratio
+  * - with --check-throughput, calls per second must not fall below the
+  *   baseline by more than the throughput tolerance, a fraction of the baseline,
+  *   and the workspace backed converters must reach half of the ideal speedup
+  *   on the cores in the CPU affinity mask
+  *
+  * Throughput baselines are machine dependent, so the absolute throughput check
+  * is opt-in. Regenerate the baselines on the machine that runs the suite with
+  * --update-baselines.
+  *
+  * Usage: perf_tardigrade_abaqus_tools --baselines FILE [--update-baselines] [--check-throughput]
+  *                                     [--throughput-tolerance X] [--allocation-tolerance N]
+  ******************************************************************************
+  */
+
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<cmath>
+#include<cstdlib>
+#include<filesystem>
+#include<fstream>
+#include<functional>
+#include<iomanip>
+#include<iostream>
+#include<map>
+#include<new>
+#include<random>
+#include<sstream>
+#include<stdexcept>
+#include<string>
+#include<thread>
+#include<vector>
+
+#ifdef __linux__
+#include<sched.h>
+#endif
+
+#include<tardigrade_abaqus_tools.h>
+#include<tardigrade_abaqus_snapshot.h>
+
+#include"mock_abaqus_driver.h"
+
+namespace{
+
+    //! The number of heap allocations made by the calling thread
+    thread_local unsigned long long allocation_count = 0;
+
+    void *countedAllocation( const std::size_t size ){
+        allocation_count++;
+        void *pointer = std::malloc( size == 0 ? 1 : size );
+        if ( !pointer ){
+            throw std::bad_alloc( );
+        }
+        return pointer;
+    }
+
+    void *countedAlignedAllocation( const std::size_t size, const std::align_val_t alignment ){
+        allocation_count++;
+        const std::size_t align = static_cast< std::size_t >( alignment );
+        void *pointer = std::aligned_alloc( align, ( ( std::max< std::size_t >( size, 1 ) + align - 1 ) / align ) * align );
+        if ( !pointer ){
+            throw std::bad_alloc( );
+        }
+        return pointer;
+    }
+
+}
+
+void *operator new( std::size_t size ){ return countedAllocation( size ); }
+void *operator new[]( std::size_t size ){ return countedAllocation( size ); }
+void *operator new( std::size_t size, std::align_val_t alignment ){ return countedAlignedAllocation( size, alignment ); }
+void *operator new[]( std::size_t size, std::align_val_t alignment ){ return countedAlignedAllocation( size, alignment ); }
+void *operator new( std::size_t size, const std::nothrow_t& ) noexcept{
+    try{ return countedAllocation( size ); } catch( ... ){ return nullptr; }
+}
+void *operator new[]( std::size_t size, const std::nothrow_t& ) noexcept{
+    try{ return countedAllocation( size ); } catch( ... ){ return nullptr; }
+}
+void operator delete( void *pointer ) noexcept{ std::free( pointer ); }
+void operator delete[]( void *pointer ) noexcept{ std::free( pointer ); }
+void operator delete( void *pointer, std::size_t ) noexcept{ std::free( pointer ); }
+void operator delete[]( void *pointer, std::size_t ) noexcept{ std::free( pointer ); }
+void operator delete( void *pointer, std::align_val_t ) noexcept{ std::free( pointer ); }
+void operator delete[]( void *pointer, std::align_val_t ) noexcept{ std::free( pointer ); }
+void operator delete( void *pointer, std::size_t, std::align_val_t ) noexcept{ std::free( pointer ); }
+void operator delete[]( void *pointer, std::size_t, std::align_val_t ) noexcept{ std::free( pointer ); }
+
+namespace{
+
+    typedef std::chrono::steady_clock clock_type;
+
+    //! The number of timed repeats of every workload. The fastest repeat is reported.
+    const int repeats = 5;
+
+    //! Sink for workload results to keep the work observable
+    volatile double sink = 0.;
+
+    struct SuiteOptions{
+        /*!
+         * The performance suite command line options
+         */
+        std::string baselines;               //!< The baseline file
+        bool update = false;                 //!< Flag for writing the measured values to the baseline file
+        bool check_throughput = false;       //!< Flag for comparing the throughput against the baselines
+        double throughput_tolerance = 0.5;   //!< The allowed fractional throughput loss
+        double allocation_tolerance = 0.;    //!< The allowed additional allocations per call
+    };
+
+    struct Workload{
+        /*!
+         * A fixed workload of the performance suite
+         */
+        std::string name;                    //!< The workload name in the baseline file
+        long calls;                          //!< The number of calls per timed repeat
+        std::function< void( ) > call;       //!< A single workload call
+        std::string reference = "";          //!< The workload of the same run this workload must outperform, if any
+        double minimum_speedup = 0.;         //!< The minimum throughput ratio over the reference workload
+    };
+
+    struct Measurement{
+        /*!
+         * The measured or baseline performance of a workload
+         */
+        double allocations = 0.;             //!< Heap allocations per call
+        double throughput = 0.;              //!< Calls per second
+    };
+
+    void printUsage( ){
+        std::cerr << "Usage: perf_tardigrade_abaqus_tools --baselines FILE [--update-baselines] [--check-throughput]"
+                  << " [--throughput-tolerance X] [--allocation-tolerance N]" << std::endl;
+    }
+
+    SuiteOptions parseOptions( int argc, char **argv ){
+        /*!
+         * Parse the performance suite command line options
+         *
+         * \param argc: The number of command line arguments
+         * \param **argv: The command line arguments
+         * \returns options: The suite options
+         */
+
+        SuiteOptions options;
+        for ( int index = 1; index < argc; index++ ){
+            const std::string flag = argv[ index ];
+            if ( flag == "--update-baselines" ){
+                options.update = true;
+                continue;
+            }
+            if ( flag == "--check-throughput" ){
+                options.check_throughput = true;
+                continue;
+            }
+            if ( index + 1 >= argc ){
+                throw std::invalid_argument( "Missing value for option '" + flag + "'" );
+            }
+            const std::string value = argv[ ++index ];
+            if ( flag == "--baselines" ){
+                options.baselines = value;
+            }
+            else if ( flag == "--throughput-tolerance" ){
+                options.throughput_tolerance = std::stod( value );
+            }
+            else if ( flag == "--allocation-tolerance" ){
+                options.allocation_tolerance = std::stod( value );
+            }
+            else{
+                throw std::invalid_argument( "Unknown option '" + flag + "'" );
+            }
+        }
+
+        if ( options.baselines.empty( ) ){
+            throw std::invalid_argument( "The baseline file is required" );
+        }
+        if ( ( options.throughput_tolerance < 0. ) || ( options.throughput_tolerance >= 1. ) ){
+            throw std::invalid_argument( "The throughput tolerance must be in [0, 1)" );
+        }
+        if ( options.allocation_tolerance < 0. ){
+            throw std::invalid_argument( "The allocation tolerance must be non-negative" );
+        }
+        return options;
+    }
+
+    Measurement measure( const Workload &workload ){
+        /*!
+         * Run a workload and measure its allocations per call and best throughput
+         *
+         * \param &workload: The workload to run
+         * \returns measurement: The measured performance
+         */
+
+        //Warm up lazily initialized state, e.g. the thread workspace and the parameter cache entries
+        for ( long call = 0; call < workload.calls / 10 + 1; call++ ){
+            workload.call( );
+        }
+
+        Measurement measurement;
+        unsigned long long allocations = 0;
+        double best_seconds = 0.;
+        for ( int repeat = 0; repeat < repeats; repeat++ ){
+            const unsigned long long start_count = allocation_count;
+            const clock_type::time_point start = clock_type::now( );
+            for ( long call = 0; call < workload.calls; call++ ){
+                workload.call( );
+            }
+            const double seconds = std::chrono::duration< double >( clock_type::now( ) - start ).count( );
+            allocations += allocation_count - start_count;
+            if ( ( repeat == 0 ) || ( seconds < best_seconds ) ){
+                best_seconds = seconds;
+            }
+        }
+        measurement.allocations = static_cast< double >( allocations ) / ( static_cast< double >( repeats ) * workload.calls );
+        measurement.throughput = workload.calls / std::max( best_seconds, 1.e-9 );
+        return measurement;
+    }
+
+    std::map< std::string, Measurement > readBaselines( const std::string &filename ){
+        /*!
+         * Read a baseline file of ``name allocations_per_call calls_per_second`` lines. Blank lines and lines starting
+         * with # are ignored.
+         *
+         * \param &filename: The baseline file
+         * \returns baselines: The baselines by workload name
+         */
+
+        std::ifstream file( filename );
+        if ( !file ){
+            throw std::runtime_error( "Unable to open the baseline file " + filename );
+        }
+        std::map< std::string, Measurement > baselines;
+        std::string line;
+        while ( std::getline( file, line ) ){
+            if ( line.empty( ) || ( line[ 0 ] == '#' ) ){
+                continue;
+            }
+            std::istringstream stream( line );
+            std::string name;
+            Measurement baseline;
+            if ( !( stream >> name >> baseline.allocations >> baseline.throughput ) ){
+                throw std::runtime_error( "Malformed baseline line '" + line + "' in " + filename );
+            }
+            baselines[ name ] = baseline;
+        }
+        return baselines;
+    }
+
+    void writeBaselines( const std::string &filename, const std::vector< Workload > &workloads,
+                         const std::map< std::string, Measurement > &measurements ){
+        /*!
+         * Write the measured values as the new baseline file
+         *
+         * \param &filename: The baseline file
+         * \param &workloads: The workloads in suite order
+         * \param &measurements: The measured values by workload name
+         */
+
+        std::ofstream file( filename );
+        if ( !file ){
+            throw std::runtime_error( "Unable to write the baseline file " + filename );
+        }
+        file << "# Performance baselines of perf_tardigrade_abaqus_tools\n"
+             << "# Regenerate with: perf_tardigrade_abaqus_tools --baselines <this file> --update-baselines\n"
+             << "# workload allocations_per_call calls_per_second\n";
+        for ( const Workload &workload : workloads ){
+            const Measurement &measurement = measurements.at( workload.name );
+            file << workload.name << " " << measurement.allocations << " "
+                 << std::setprecision( 3 ) << measurement.throughput << std::setprecision( 6 ) << "\n";
+        }
+    }
+
+    //Shared workload inputs
+    const std::vector< double > abaqus_vector = { 1., 2., 3., 4., 5., 6. };
+    const std::vector< double > full_tensor = { 11., 12., 13., 12., 22., 23., 13., 23., 33. };
+
+    std::vector< std::vector< double > > fullMatrix( ){
+        std::vector< std::vector< double > > matrix( 9, std::vector< double >( 9 ) );
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                matrix[ i ][ j ] = 10. * i + j;
+            }
+        }
+        return matrix;
+    }
+
+    struct ElasticParameters{
+        /*!
+         * Material parameters for the parameter cache workload
+         */
+        ElasticParameters( const double *PROPS, const int & ) : youngs_modulus( PROPS[ 0 ] ), poisson_ratio( PROPS[ 1 ] ){ }
+
+        double youngs_modulus;
+        double poisson_ratio;
+    };
+
+    struct VUMATBlock{
+        /*!
+         * A VUMAT block for the frame rotation workloads
+         */
+        VUMATBlock( ) : stress( 6 * nblock, 1. ), rotated( 6 * nblock, 0. ){
+            for ( const double value : { 1.01, 0.99, 1., 0.001, 0., 0. } ){
+                stretch.insert( stretch.end( ), nblock, value );
+            }
+            for ( const double value : { 1.01, 0.99, 1., 0.011, 0., 0., -0.009, 0., 0. } ){
+                defgrad.insert( defgrad.end( ), nblock, value );
+            }
+        }
+
+        const int nblock = 136;
+        std::vector< double > stretch;
+        std::vector< double > defgrad;
+        std::vector< double > stress;
+        std::vector< double > rotated;
+    };
+
+    struct TemporaryFile{
+        /*!
+         * A unique file name in the temporary directory. The file is removed on destruction.
+         */
+        explicit TemporaryFile( const std::string &name )
+            : path( ( std::filesystem::temp_directory_path( )
+                      / ( name + "_" + std::to_string( std::random_device( )( ) ) + ".bin" ) ).string( ) ){ }
+
+        ~TemporaryFile( ){
+            std::error_code error;
+            std::filesystem::remove( path, error );
+        }
+
+        const std::string path;
+    };
+
+    VUMATBlock &vumatBlock( ){
+        static VUMATBlock block;
+        return block;
+    }
+
+    unsigned int usableCores( ){
+        /*!
+         * Get the number of cores in the CPU affinity mask of the process. ``std::thread::hardware_concurrency``
+         * reports every core of the host, including cores a container or ``taskset`` excludes.
+         */
+#ifdef __linux__
+        cpu_set_t cpus;
+        CPU_ZERO( &cpus );
+        if ( sched_getaffinity( 0, sizeof( cpus ), &cpus ) == 0 ){
+            return std::max( 1, CPU_COUNT( &cpus ) );
+        }
+#endif
+        return std::max( 1u, std::thread::hardware_concurrency( ) );
+    }
+
+    double workspaceConverterThroughput( const unsigned int &threads ){
+        /*!
+         * Measure the aggregate throughput of threads calling the converters with workspace backed containers. The
+         * threads are started before the clock so thread start-up is not timed.
+         *
+         * \param &threads: The number of threads
+         * \returns throughput: The best aggregate calls per second of the timed repeats
+         */
+
+        const long calls = 200000;
+        double best_seconds = 0.;
+        for ( int repeat = 0; repeat < repeats; repeat++ ){
+            std::atomic< unsigned int > ready( 0 );
+            std::atomic< bool > start( false );
+            std::vector< double > totals( threads, 0. );
+            std::vector< std::thread > workers;
+            for ( unsigned int thread = 0; thread < threads; thread++ ){
+                workers.emplace_back( [ &, thread ]( ){
+                    ready++;
+                    while ( !start.load( std::memory_order_acquire ) ){
+                        std::this_thread::yield( );
+                    }
+                    double total = 0.;
+                    for ( long call = 0; call < calls; call++ ){
+                        tardigradeAbaqusTools::WorkspaceScope scope;
+                        tardigradeAbaqusTools::workspace_vector< double > vector( abaqus_vector.begin( ), abaqus_vector.end( ) );
+                        tardigradeAbaqusTools::workspace_vector< double > tensor =
+                            tardigradeAbaqusTools::expandFullNTENSTensor( vector, 3, 3 );
+                        tardigradeAbaqusTools::workspace_vector< double > contracted =
+                            tardigradeAbaqusTools::contractFullNTENSTensor( tensor, 3, 3 );
+                        total += contracted[ 5 ];
+                    }
+                    totals[ thread ] = total;
+                } );
+            }
+            while ( ready.load( ) < threads ){
+                std::this_thread::yield( );
+            }
+            const clock_type::time_point begin = clock_type::now( );
+            start.store( true, std::memory_order_release );
+            for ( std::thread &worker : workers ){
+                worker.join( );
+            }
+            const double seconds = std::chrono::duration< double >( clock_type::now( ) - begin ).count( );
+            if ( ( repeat == 0 ) || ( seconds < best_seconds ) ){
+                best_seconds = seconds;
+            }
+            for ( const double total : totals ){
+                sink = sink + total;
+            }
+        }
+        return threads * calls / std::max( best_seconds, 1.e-9 );
+    }
+
+    std::vector< Workload > makeWorkloads( ){
+        /*!
+         * Build the fixed workloads of the suite
+         */
+
+        std::vector< Workload > workloads;
+
+        workloads.push_back( { "expandFullNTENSTensor", 200000, [ ]( ){
+            std::vector< double > tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, 3, 3 );
+            sink = sink + tensor[ 4 ];
+        } } );
+
+        workloads.push_back( { "contractFullNTENSTensor", 200000, [ ]( ){
+            std::vector< double > vector = tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, 3, 3 );
+            sink = sink + vector[ 5 ];
+        } } );
+
+        workloads.push_back( { "contractFullNTENSMatrix", 20000, [ ]( ){
+            static const std::vector< std::vector< double > > full_matrix = fullMatrix( );
+            std::vector< std::vector< double > > matrix = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, 3, 3 );
+            sink = sink + matrix[ 5 ][ 5 ];
+        } } );
+
+        workloads.push_back( { "workspaceExpandFullNTENSTensor", 200000, [ ]( ){
+            tardigradeAbaqusTools::WorkspaceScope scope;
+            tardigradeAbaqusTools::workspace_vector< double > input( abaqus_vector.begin( ), abaqus_vector.end( ) );
+            tardigradeAbaqusTools::workspace_vector< double > tensor = tardigradeAbaqusTools::expandFullNTENSTensor( input, 3, 3 );
+            sink = sink + tensor[ 4 ];
+        } } );
+
+        workloads.push_back( { "fusedNTENSKernels", 200000, [ ]( ){
+            static const std::vector< std::vector< double > > full_matrix = fullMatrix( );
+            static std::vector< double > full_matrix_array;
+            if ( full_matrix_array.empty( ) ){
+                for ( const std::vector< double > &row : full_matrix ){
+                    full_matrix_array.insert( full_matrix_array.end( ), row.begin( ), row.end( ) );
+                }
+            }
+            double tensor[ 9 ], vector[ 6 ], ddsdde[ 36 ];
+            tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector.data( ), 3, 3, tensor );
+            tardigradeAbaqusTools::contractFullNTENSTensor( tensor, 3, 3, vector );
+            tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix_array.data( ), 3, 3, ddsdde );
+            sink = sink + vector[ 5 ] + ddsdde[ 35 ];
+        } } );
+
+        workloads.push_back( { "rowToColumnMajor", 200000, [ ]( ){
+            static const std::vector< double > row_major( 36, 1. );
+            double column_major[ 36 ];
+            tardigradeAbaqusTools::rowToColumnMajor( column_major, row_major, 6, 6 );
+            sink = sink + column_major[ 7 ];
+        } } );
+
+        workloads.push_back( { "soaPackUnpackVUMATBlock", 20000, [ ]( ){
+            const int nblock = 136;
+            static std::vector< double > block( 6 * nblock, 1. );
+            static tardigradeAbaqusTools::SoABuffer< double > soa;
+            tardigradeAbaqusTools::packNTENSBlock( nblock, 3, 3, block.data( ), soa, false );
+            for ( int point = 0; point < soa.stride( ); point++ ){
+                soa.component( 0 )[ point ] *= 1.0001;
+            }
+            tardigradeAbaqusTools::unpackNTENSBlock( soa, nblock, 3, 3, block.data( ), false );
+            sink = sink + block[ 0 ];
+        } } );
+
+        workloads.push_back( { "pointwiseVUMATPushForward", 20000, [ ]( ){
+            VUMATBlock &block = vumatBlock( );
+            for ( int point = 0; point < block.nblock; point++ ){
+                double R[ 3 ][ 3 ];
+                tardigradeAbaqusTools::computeVUMATPointRotation( block.nblock, 3, 3, block.stretch.data( ), block.defgrad.data( ),
+                                                                  point, R );
+                tardigradeAbaqusTools::rotateVUMATPoint( block.nblock, 3, 3, R, block.stress.data( ), block.rotated.data( ), point );
+            }
+            sink = sink + block.rotated[ 0 ];
+        } } );
+
+        workloads.push_back( { "pushForwardVUMATBlock", 20000, [ ]( ){
+            VUMATBlock &block = vumatBlock( );
+            tardigradeAbaqusTools::pushForwardVUMATBlock( block.nblock, 3, 3, block.stretch.data( ), block.defgrad.data( ),
+                                                          block.stress.data( ), block.rotated.data( ) );
+            sink = sink + block.rotated[ 0 ];
+        }, "pointwiseVUMATPushForward", 1.2 } );
+
+        workloads.push_back( { "materialParameterCacheHit", 200000, [ ]( ){
+            static tardigradeAbaqusTools::MaterialParameterCache< ElasticParameters > cache;
+            static const std::string CMNAME = std::string( "STEEL" ) + std::string( CMNAME_LENGTH - 5, ' ' );
+            static const double PROPS[ 2 ] = { 200.e3, 0.3 };
+            const ElasticParameters &parameters = cache.get( CMNAME.data( ), CMNAME_LENGTH, PROPS, 2 );
+            sink = sink + parameters.youngs_modulus;
+        } } );
+
+        workloads.push_back( { "snapshotSubmit", 100000, [ ]( ){
+            //Constructed before and so destroyed after the writer
+            static const TemporaryFile file( "perf_tardigrade_abaqus_tools_snapshot" );
+            static tardigradeAbaqusTools::SnapshotWriter writer( file.path, 6, 4, 1 << 16, 256,
+                                                                 tardigradeAbaqusTools::SnapshotBackPressure::DROP );
+            static const double STATEV[ 4 ] = { 0., 1., 2., 3. };
+            writer.submit( 1, 1, 1, 1, 0., abaqus_vector.data( ), STATEV );
+        } } );
+
+        workloads.push_back( { "mockUMAT", 20000, [ ]( ){
+            static const std::string CMNAME = std::string( "ELASTIC" ) + std::string( CMNAME_LENGTH - 7, ' ' );
+            static const double PROPS[ 2 ] = { 200.e3, 0.3 };
+            const int NDI = 3, NSHR = 3, NTENS = 6, NSTATV = 1, NPROPS = 2, NOEL = 1, NPT = 1, LAYER = 1, KSPT = 1, KINC = 1;
+            const int JSTEP[ 4 ] = { 1, 0, 0, 0 };
+            double STRESS[ 6 ] = { }, STATEV[ 1 ] = { }, DDSDDE[ 36 ], DDSDDT[ 6 ], DRPLDE[ 6 ];
+            double SSE = 0., SPD = 0., SCD = 0., RPL = 0., DRPLDT = 0., PNEWDT = 1.;
+            const double STRAN[ 6 ] = { 1.e-3, -3.e-4, -3.e-4, 2.e-4, 0., 0. }, DSTRAN[ 6 ] = { 1.e-5, 0., 0., 0., 0., 0. };
+            const double TIME[ 2 ] = { 0., 0. }, COORDS[ 3 ] = { }, DROT[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+            const double DFGRD[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+            const double DTIME = 1., TEMP = 0., DTEMP = 0., CELENT = 1.;
+            umat_( STRESS, STATEV, DDSDDE, SSE, SPD, SCD, RPL, DDSDDT, DRPLDE, DRPLDT, STRAN, DSTRAN, TIME, DTIME, TEMP,
+                   DTEMP, nullptr, nullptr, CMNAME.data( ), NDI, NSHR, NTENS, NSTATV, PROPS, NPROPS, COORDS, DROT, PNEWDT,
+                   CELENT, DFGRD, DFGRD, NOEL, NPT, LAYER, KSPT, JSTEP, KINC, CMNAME_LENGTH );
+            sink = sink + STRESS[ 0 ];
+        } } );
+
+        return workloads;
+    }
+
+}
+
+int main( int argc, char **argv ){
+
+    SuiteOptions options;
+    try{
+        options = parseOptions( argc, argv );
+    }
+    catch( std::exception &error ){
+        std::cerr << "ERROR: " << error.what( ) << std::endl;
+        printUsage( );
+        return 1;
+    }
+
+    try{
+        const std::vector< Workload > workloads = makeWorkloads( );
+        std::map< std::string, Measurement > baselines;
+        if ( !options.update ){
+            baselines = readBaselines( options.baselines );
+        }
+
+        std::cout << std::left << std::setw( 32 ) << "workload" << std::right
+                  << std::setw( 14 ) << "allocs/call" << std::setw( 14 ) << "baseline"
+                  << std::setw( 14 ) << "calls/s" << std::setw( 14 ) << "baseline" << "  status" << std::endl;
+
+        std::map< std::string, Measurement > measurements;
+        int failures = 0;
+        for ( const Workload &workload : workloads ){
+            const Measurement measurement = measure( workload );
+            measurements[ workload.name ] = measurement;
+
+            std::cout << std::left << std::setw( 32 ) << workload.name << std::right
+                      << std::setw( 14 ) << measurement.allocations;
+            if ( options.update ){
+                std::cout << std::setw( 14 ) << "-" << std::setw( 14 ) << std::setprecision( 3 ) << measurement.throughput
+                          << std::setprecision( 6 ) << std::setw( 14 ) << "-" << "  updated" << std::endl;
+                continue;
+            }
+
+            const std::map< std::string, Measurement >::const_iterator baseline = baselines.find( workload.name );
+            if ( baseline == baselines.end( ) ){
+                std::cout << std::setw( 14 ) << "-" << std::setw( 14 ) << std::setprecision( 3 ) << measurement.throughput
+                          << std::setprecision( 6 ) << std::setw( 14 ) << "-" << "  FAILED: no baseline" << std::endl;
+                failures++;
+                continue;
+            }
+
+            std::string status = "ok";
+            if ( measurement.allocations > baseline->second.allocations + options.allocation_tolerance + 1.e-9 ){
+                status = "FAILED: allocation regression";
+            }
+            else if ( options.check_throughput
+                      && ( measurement.throughput < ( 1. - options.throughput_tolerance ) * baseline->second.throughput ) ){
+                status = "FAILED: throughput regression";
+            }
+            else if ( measurement.allocations < baseline->second.allocations - 1.e-9 ){
+                status = "ok, fewer allocations than the baseline";
+            }
+            failures += ( status.compare( 0, 6, "FAILED" ) == 0 );
+
+            std::cout << std::setw( 14 ) << baseline->second.allocations
+                      << std::setw( 14 ) << std::setprecision( 3 ) << measurement.throughput
+                      << std::setw( 14 ) << baseline->second.throughput << std::setprecision( 6 )
+                      << "  " << status << std::endl;
+        }
+
+        //Machine independent throughput ratios against a reference workload of the same run
+        for ( const Workload &workload : workloads ){
+            if ( workload.reference.empty( ) ){
+                continue;
+            }
+            const double speedup = measurements.at( workload.name ).throughput / measurements.at( workload.reference ).throughput;
+            const bool failed = speedup < workload.minimum_speedup;
+            std::cout << workload.name << " / " << workload.reference << " throughput: " << std::setprecision( 3 ) << speedup
+                      << " (minimum " << workload.minimum_speedup << ")" << std::setprecision( 6 )
+                      << ( failed ? "  FAILED: speedup regression" : "  ok" ) << std::endl;
+            failures += failed;
+        }
+
+        //Machine dependent multi-threaded scaling of the per-thread workspaces
+        const unsigned int cores = usableCores( );
+        if ( cores > 1 ){
+            const double speedup = workspaceConverterThroughput( cores ) / workspaceConverterThroughput( 1 );
+            const bool failed = options.check_throughput && !options.update && ( speedup < 0.5 * cores );
+            std::cout << "workspace converters on " << cores << " threads / 1 thread throughput: " << std::setprecision( 3 )
+                      << speedup << " (minimum " << 0.5 * cores << ")" << std::setprecision( 6 )
+                      << ( failed ? "  FAILED: scaling regression" : ( options.check_throughput ? "  ok" : "  not checked" ) )
+                      << std::endl;
+            failures += failed;
+        }
+
+        if ( options.update ){
+            writeBaselines( options.baselines, workloads, measurements );
+            std::cout << "Wrote " << options.baselines << std::endl;
+            return 0;
+        }
+
+        if ( failures > 0 ){
+            std::cerr << failures << " performance regression(s). If intended, regenerate the baselines with"
+                      << " --update-baselines" << std::endl;
+            return 1;
+        }
+    }
+    catch( std::exception &error ){
+        std::cerr << "ERROR: " << error.what( ) << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -8,9 +8,16 @@
 #define BOOST_TEST_MODULE test_tardigrade_abaqus_tools
 #include <boost/test/included/unit_test.hpp>
 
+#include<algorithm>
+#include<thread>
+#include<chrono>
+#include<filesystem>
+#include<random>
+
 #include<tardigrade_vector_tools.h>
 
 #include<tardigrade_abaqus_tools.h>
+#include<tardigrade_abaqus_snapshot.h>
 
 BOOST_AUTO_TEST_CASE( testColumnToRowMajor ){
     /*!
@@ -293,3 +300,839 @@ BOOST_AUTO_TEST_CASE( testContractFullNTENSMatrix ){
                 boost::test_tools::per_element() );
 
 }
+
+BOOST_AUTO_TEST_CASE( testVUMATFrameRotation ){
+    /*!
+     * Test the corotational frame rotation helpers on column-major VUMAT blocks
+     */
+
+    //Two points with a rotation about the 3 axis and a symmetric stretch
+    const int nblock = 2;
+    const int ndir = 3;
+    const int nshr = 3;
+    const double angle[ nblock ] = { 0.3, -1.1 };
+    const std::vector< std::vector< double > > U = { { 1.10, 0.02, 0.03,   0.02, 0.95, 0.01,   0.03, 0.01, 1.05 },
+                                                     { 0.90, 0.05, 0.00,   0.05, 1.20, 0.04,   0.00, 0.04, 1.00 } };
+
+    //Explicit block orderings: stretch 11, 22, 33, 12, 23, 13 and defgrad 11, 22, 33, 12, 23, 31, 21, 32, 13
+    const unsigned int stretch_order[ 6 ] = { 0, 4, 8, 1, 5, 2 };
+    const unsigned int defgrad_order[ 9 ] = { 0, 4, 8, 1, 5, 6, 3, 7, 2 };
+    std::vector< double > stretch( nblock * 6 ), defgrad( nblock * 9 );
+    std::vector< std::vector< double > > R( nblock, std::vector< double >( 9, 0. ) );
+    for ( int point = 0; point < nblock; point++ ){
+        R[ point ] = { std::cos( angle[ point ] ), -std::sin( angle[ point ] ), 0.,
+                       std::sin( angle[ point ] ),  std::cos( angle[ point ] ), 0.,
+                       0., 0., 1. };
+        std::vector< double > F( 9, 0. );
+        for ( unsigned int i = 0; i < 3; i++ ){
+            for ( unsigned int j = 0; j < 3; j++ ){
+                for ( unsigned int k = 0; k < 3; k++ ){
+                    F[ 3 * i + j ] += R[ point ][ 3 * i + k ] * U[ point ][ 3 * k + j ];
+                }
+            }
+        }
+        for ( unsigned int component = 0; component < 6; component++ ){
+            stretch[ component * nblock + point ] = U[ point ][ stretch_order[ component ] ];
+        }
+        for ( unsigned int component = 0; component < 9; component++ ){
+            defgrad[ component * nblock + point ] = F[ defgrad_order[ component ] ];
+        }
+    }
+
+    //Check the rotation block
+    std::vector< double > rotation( nblock * 9 );
+    tardigradeAbaqusTools::computeVUMATRotationBlock( nblock, ndir, nshr, stretch.data( ), defgrad.data( ), rotation.data( ) );
+    for ( int point = 0; point < nblock; point++ ){
+        for ( unsigned int component = 0; component < 9; component++ ){
+            BOOST_TEST( rotation[ component * nblock + point ] == R[ point ][ component ], boost::test_tools::tolerance( 1e-12 ) );
+        }
+    }
+
+    //Push forward a corotational stress block and compare against R sigma R^T
+    const std::vector< double > corotational = { 11, 21,   22, 32,   33, 43,   12, 22,   23, 33,   13, 23 };
+    std::vector< double > reference( nblock * 6 ), reference_direct( nblock * 6 );
+    tardigradeAbaqusTools::pushForwardVUMATBlock( nblock, ndir, nshr, rotation.data( ), corotational.data( ), reference.data( ) );
+    tardigradeAbaqusTools::pushForwardVUMATBlock( nblock, ndir, nshr, stretch.data( ), defgrad.data( ),
+                                                  corotational.data( ), reference_direct.data( ) );
+    for ( int point = 0; point < nblock; point++ ){
+        std::vector< double > sigma_hat( 9 );
+        for ( unsigned int component = 0; component < 6; component++ ){
+            sigma_hat[ stretch_order[ component ] ] = corotational[ component * nblock + point ];
+        }
+        sigma_hat[ 3 ] = sigma_hat[ 1 ];
+        sigma_hat[ 7 ] = sigma_hat[ 5 ];
+        sigma_hat[ 6 ] = sigma_hat[ 2 ];
+        std::vector< double > sigma( 9, 0. );
+        for ( unsigned int i = 0; i < 3; i++ ){
+            for ( unsigned int j = 0; j < 3; j++ ){
+                for ( unsigned int k = 0; k < 3; k++ ){
+                    for ( unsigned int l = 0; l < 3; l++ ){
+                        sigma[ 3 * i + j ] += R[ point ][ 3 * i + k ] * sigma_hat[ 3 * k + l ] * R[ point ][ 3 * j + l ];
+                    }
+                }
+            }
+        }
+        for ( unsigned int component = 0; component < 6; component++ ){
+            BOOST_TEST( reference[ component * nblock + point ] == sigma[ stretch_order[ component ] ],
+                        boost::test_tools::tolerance( 1e-12 ) );
+            BOOST_TEST( reference_direct[ component * nblock + point ] == sigma[ stretch_order[ component ] ],
+                        boost::test_tools::tolerance( 1e-12 ) );
+        }
+    }
+
+    //Pull back in place recovers the corotational block
+    tardigradeAbaqusTools::pullBackVUMATBlock( nblock, ndir, nshr, rotation.data( ), reference.data( ), reference.data( ) );
+    BOOST_TEST( reference == corotational, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+    tardigradeAbaqusTools::pullBackVUMATBlock( nblock, ndir, nshr, stretch.data( ), defgrad.data( ),
+                                               reference_direct.data( ), reference_direct.data( ) );
+    BOOST_TEST( reference_direct == corotational, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+
+    //Two dimensional blocks: stretch 11, 22, 33, 12 and defgrad 11, 22, 33, 12, 21
+    const int nshr_2d = 1;
+    const double theta = 0.7;
+    const std::vector< double > stretch_2d = { 1.1, 0.9, 1.0, 0.05 };
+    const double c = std::cos( theta ), s = std::sin( theta );
+    const std::vector< double > defgrad_2d = { c * 1.1 - s * 0.05, s * 0.05 + c * 0.9, 1.0, c * 0.05 - s * 0.9, s * 1.1 + c * 0.05 };
+    const std::vector< double > stress_2d = { 100., -50., 10., 25. };
+    std::vector< double > rotated_2d( 4 );
+    tardigradeAbaqusTools::pushForwardVUMATBlock( 1, ndir, nshr_2d, stretch_2d.data( ), defgrad_2d.data( ),
+                                                  stress_2d.data( ), rotated_2d.data( ) );
+    const std::vector< double > expected_2d = { c * c * 100. - 2. * c * s * 25. + s * s * -50.,
+                                                s * s * 100. + 2. * c * s * 25. + c * c * -50.,
+                                                10.,
+                                                c * s * ( 100. - -50. ) + ( c * c - s * s ) * 25. };
+    BOOST_TEST( rotated_2d == expected_2d, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+
+    //The vectorized block kernels match the point helpers for every ndir and nshr, in place and out of place
+    const int points = 5;
+    for ( int ndir_case = 1; ndir_case <= 3; ndir_case++ ){
+        for ( int nshr_case = 0; nshr_case <= 3; nshr_case++ ){
+            const int ntens = ndir_case + nshr_case;
+            std::vector< double > stretch_case( points * ntens ), defgrad_case( points * ( ntens + nshr_case ) );
+            std::vector< double > stress_case( points * ntens );
+            for ( int point = 0; point < points; point++ ){
+                for ( int component = 0; component < ntens; component++ ){
+                    stretch_case[ component * points + point ] = component < ndir_case ? 1. + 0.01 * ( point + component ) : 0.02 * component;
+                    stress_case[ component * points + point ] = 10. * component - point;
+                }
+                for ( int component = 0; component < ntens + nshr_case; component++ ){
+                    defgrad_case[ component * points + point ] = component < ndir_case ? 0.9 + 0.05 * point : 0.03 * ( component - point );
+                }
+            }
+
+            std::vector< double > rotation_case( points * 9 ), expected_case( points * ntens ), expected_back( points * ntens );
+            for ( int point = 0; point < points; point++ ){
+                double Q[ 3 ][ 3 ];
+                tardigradeAbaqusTools::computeVUMATPointRotation( points, ndir_case, nshr_case, stretch_case.data( ),
+                                                                  defgrad_case.data( ), point, Q );
+                const double QT[ 3 ][ 3 ] = { { Q[ 0 ][ 0 ], Q[ 1 ][ 0 ], Q[ 2 ][ 0 ] },
+                                              { Q[ 0 ][ 1 ], Q[ 1 ][ 1 ], Q[ 2 ][ 1 ] },
+                                              { Q[ 0 ][ 2 ], Q[ 1 ][ 2 ], Q[ 2 ][ 2 ] } };
+                for ( unsigned int component = 0; component < 9; component++ ){
+                    rotation_case[ component * points + point ] = Q[ component / 3 ][ component % 3 ];
+                }
+                tardigradeAbaqusTools::rotateVUMATPoint( points, ndir_case, nshr_case, Q, stress_case.data( ),
+                                                         expected_case.data( ), point );
+                tardigradeAbaqusTools::rotateVUMATPoint( points, ndir_case, nshr_case, QT, stress_case.data( ),
+                                                         expected_back.data( ), point );
+            }
+
+            std::vector< double > rotation_block( points * 9 );
+            tardigradeAbaqusTools::computeVUMATRotationBlock( points, ndir_case, nshr_case, stretch_case.data( ),
+                                                              defgrad_case.data( ), rotation_block.data( ) );
+            BOOST_TEST( rotation_block == rotation_case, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+
+            std::vector< double > result( points * ntens ), in_place = stress_case;
+            tardigradeAbaqusTools::pushForwardVUMATBlock( points, ndir_case, nshr_case, rotation_block.data( ),
+                                                          stress_case.data( ), result.data( ) );
+            BOOST_TEST( result == expected_case, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+            tardigradeAbaqusTools::pushForwardVUMATBlock( points, ndir_case, nshr_case, stretch_case.data( ),
+                                                          defgrad_case.data( ), in_place.data( ), in_place.data( ) );
+            BOOST_TEST( in_place == expected_case, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+
+            in_place = stress_case;
+            tardigradeAbaqusTools::pullBackVUMATBlock( points, ndir_case, nshr_case, rotation_block.data( ),
+                                                       in_place.data( ), in_place.data( ) );
+            BOOST_TEST( in_place == expected_back, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+            tardigradeAbaqusTools::pullBackVUMATBlock( points, ndir_case, nshr_case, stretch_case.data( ),
+                                                       defgrad_case.data( ), stress_case.data( ), result.data( ) );
+            BOOST_TEST( result == expected_back, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element() );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testThreadWorkspace ){
+    /*!
+     * Test the per-thread workspace, workspace scope and workspace allocator
+     */
+
+    tardigradeAbaqusTools::ThreadWorkspace &workspace = tardigradeAbaqusTools::threadWorkspace( );
+    BOOST_TEST( &workspace == &tardigradeAbaqusTools::threadWorkspace( ) );
+    BOOST_TEST( workspace.capacity( ) == TARDIGRADE_ABAQUS_TOOLS_WORKSPACE_CAPACITY );
+    const std::size_t start = workspace.used( );
+    const std::size_t overflows = workspace.overflows( );
+
+    {
+        tardigradeAbaqusTools::WorkspaceScope scope;
+
+        //Converter outputs and temporaries inherit the workspace allocator of the input
+        tardigradeAbaqusTools::workspace_vector< double > abaqus_explicit = { 11, 22, 33, 12, 23, 13 };
+        tardigradeAbaqusTools::workspace_vector< double > full_tensor =
+            tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_explicit, 3, 3, false );
+        const std::vector< double > expected = { 11, 12, 13,
+                                                 12, 22, 23,
+                                                 13, 23, 33 };
+        BOOST_TEST( std::vector< double >( full_tensor.begin( ), full_tensor.end( ) ) == expected, boost::test_tools::per_element() );
+        BOOST_TEST( workspace.owns( full_tensor.data( ) ) );
+        BOOST_TEST( workspace.used( ) > start );
+
+        //Allocations larger than the workspace fall back to the heap
+        tardigradeAbaqusTools::workspace_vector< double > large( workspace.capacity( ) / sizeof( double ) + 1 );
+        BOOST_TEST( !workspace.owns( large.data( ) ) );
+        BOOST_TEST( workspace.overflows( ) == overflows + 1 );
+
+        //Fortran arrays convert directly into workspace backed matrices
+        const double column_major[ 6 ] = { 1, 4, 2, 5, 3, 6 };
+        tardigradeAbaqusTools::workspace_matrix< double > row_major =
+            tardigradeAbaqusTools::columnToRowMajor( column_major, 2, 3, tardigradeAbaqusTools::WorkspaceAllocator< double >( ) );
+        BOOST_TEST( workspace.owns( row_major.data( ) ) );
+        BOOST_TEST( workspace.owns( row_major[ 1 ].data( ) ) );
+        BOOST_TEST( std::vector< double >( row_major[ 1 ].begin( ), row_major[ 1 ].end( ) ) == std::vector< double >( { 4, 5, 6 } ),
+                    boost::test_tools::per_element() );
+
+        //A container created before an inner scope grows on the heap inside it and survives the inner scope
+        tardigradeAbaqusTools::workspace_vector< double > outer( 2, 1. );
+        BOOST_TEST( workspace.owns( outer.data( ) ) );
+        {
+            tardigradeAbaqusTools::WorkspaceScope inner_scope;
+            BOOST_TEST( workspace.depth( ) == 2 );
+            outer.resize( 64, 2. );
+            BOOST_TEST( !workspace.owns( outer.data( ) ) );
+            tardigradeAbaqusTools::workspace_vector< double > inner( 64, 3. );
+            BOOST_TEST( workspace.owns( inner.data( ) ) );
+        }
+        tardigradeAbaqusTools::workspace_vector< double > reuse( 64, 4. );
+        BOOST_TEST( ( ( outer[ 0 ] == 1. ) && ( outer[ 63 ] == 2. ) ) );
+
+        //A container moved out of an inner scope copies its elements instead of taking over reclaimed memory
+        tardigradeAbaqusTools::workspace_vector< double > assigned( 1, 0. );
+        {
+            tardigradeAbaqusTools::WorkspaceScope inner_scope;
+            tardigradeAbaqusTools::workspace_vector< double > inner( 16, 7. );
+            BOOST_TEST( ( inner.get_allocator( ) != assigned.get_allocator( ) ) );
+            assigned = std::move( inner );
+            BOOST_TEST( !workspace.owns( assigned.data( ) ) );
+        }
+        tardigradeAbaqusTools::workspace_vector< double > clobber( 16, -1. );
+        BOOST_TEST( ( ( assigned.size( ) == 16 ) && ( assigned[ 0 ] == 7. ) && ( assigned[ 15 ] == 7. ) ) );
+
+        //Workspace memory may be freed by another thread without touching that thread's workspace
+        tardigradeAbaqusTools::workspace_vector< double > moved( 8, 5. );
+        BOOST_TEST( tardigradeAbaqusTools::WorkspaceAllocator< double >( ).workspace( ) == &workspace );
+        std::thread destroyer( [ vector = std::move( moved ) ]( ) mutable{
+            vector.clear( );
+            vector.shrink_to_fit( );
+        } );
+        destroyer.join( );
+    }
+
+    BOOST_TEST( workspace.used( ) == start );
+    BOOST_TEST( workspace.depth( ) == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( testThreadWorkspaceConcurrentConverters ){
+    /*!
+     * Test many threads calling the converters with workspace backed containers at once. Every thread must get its own
+     * workspace and produce correct results without heap fallbacks. The throughput scaling is checked by the
+     * performance suite.
+     */
+
+    const unsigned int iterations = 2000;
+    const unsigned int nthreads = 4;
+
+    struct ThreadResult{
+        bool correct = true;
+        std::size_t used = 1;
+        std::size_t overflows = 1;
+        const void *buffer = nullptr;
+    };
+
+    auto worker = [ & ]( ThreadResult &result ){
+        const std::vector< double > expected_tensor = { 11, 12, 0, 12, 22, 0, 0, 0, 33 };
+        const std::vector< double > expected_vector = { 11, 22, 33, 12 };
+        for ( unsigned int iteration = 0; iteration < iterations; iteration++ ){
+            tardigradeAbaqusTools::WorkspaceScope scope;
+            tardigradeAbaqusTools::workspace_vector< double > abaqus_vector = { 11, 22, 33, 12 };
+            tardigradeAbaqusTools::workspace_vector< double > full_tensor =
+                tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, 3, 1 );
+            tardigradeAbaqusTools::workspace_vector< double > contracted =
+                tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, 3, 1 );
+            tardigradeAbaqusTools::workspace_matrix< double > full_matrix( 9, tardigradeAbaqusTools::workspace_vector< double >( 9, 1. ) );
+            tardigradeAbaqusTools::workspace_matrix< double > abaqus_matrix =
+                tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, 3, 1 );
+            result.correct = result.correct
+                          && std::equal( full_tensor.begin( ), full_tensor.end( ), expected_tensor.begin( ) )
+                          && std::equal( contracted.begin( ), contracted.end( ), expected_vector.begin( ) )
+                          && ( abaqus_matrix.size( ) == 4 ) && ( abaqus_matrix[ 3 ][ 3 ] == 1. );
+        }
+        tardigradeAbaqusTools::ThreadWorkspace &workspace = tardigradeAbaqusTools::threadWorkspace( );
+        result.used = workspace.used( );
+        result.overflows = workspace.overflows( );
+        result.buffer = workspace.data( );
+    };
+
+    std::vector< ThreadResult > results( nthreads );
+    std::vector< std::thread > threads;
+    for ( unsigned int thread = 0; thread < nthreads; thread++ ){
+        threads.emplace_back( worker, std::ref( results[ thread ] ) );
+    }
+    for ( std::thread &thread : threads ){
+        thread.join( );
+    }
+
+    std::vector< const void* > buffers;
+    for ( const ThreadResult &result : results ){
+        BOOST_TEST( result.correct );
+        BOOST_TEST( result.used == 0 );
+        BOOST_TEST( result.overflows == 0 );
+        buffers.push_back( result.buffer );
+    }
+    std::sort( buffers.begin( ), buffers.end( ) );
+    BOOST_TEST( ( std::unique( buffers.begin( ), buffers.end( ) ) == buffers.end( ) ) );
+
+}
+
+namespace{
+
+    struct ElasticParameters{
+        /*!
+         * A typed material parameter struct for testing the material parameter cache
+         */
+
+        ElasticParameters( const double *PROPS, const int &NPROPS ){
+            parses++;
+            if ( NPROPS != 2 ){
+                throw std::invalid_argument( "Expected PROPS = { Young's modulus, Poisson's ratio }" );
+            }
+            youngs_modulus = PROPS[ 0 ];
+            poisson_ratio = PROPS[ 1 ];
+            shear_modulus = youngs_modulus / ( 2. * ( 1. + poisson_ratio ) );
+        }
+
+        double youngs_modulus;
+        double poisson_ratio;
+        double shear_modulus;
+
+        static int parses;
+    };
+
+    int ElasticParameters::parses = 0;
+
+}
+
+BOOST_AUTO_TEST_CASE( testMaterialParameterCache ){
+    /*!
+     * Test parsing PROPS once into a cached, typed material parameter struct
+     */
+
+    tardigradeAbaqusTools::MaterialParameterCache< ElasticParameters > cache;
+    std::vector< char > CMNAME( 80, ' ' );
+    std::string name = "STEEL";
+    std::copy( name.begin( ), name.end( ), CMNAME.begin( ) );
+    const int CMNAME_length = CMNAME.size( );
+    std::vector< double > PROPS = { 200.e3, 0.25 };
+    const int NPROPS = PROPS.size( );
+
+    //First call parses, second call returns the same cached parameters
+    const ElasticParameters &first = cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), NPROPS );
+    const ElasticParameters &second = cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), NPROPS );
+    BOOST_TEST( ElasticParameters::parses == 1 );
+    BOOST_TEST( &first == &second );
+    BOOST_TEST( first.shear_modulus == 80.e3 );
+    BOOST_TEST( cache.size( ) == 1 );
+
+    //Trailing blank padding is not part of the material name
+    std::vector< char > short_name( name.begin( ), name.end( ) );
+    BOOST_TEST( &cache.get( short_name.data( ), short_name.size( ), PROPS.data( ), NPROPS ) == &first );
+    BOOST_TEST( ElasticParameters::parses == 1 );
+
+    //A different material with the same properties is parsed separately
+    CMNAME[ 5 ] = '2';
+    const ElasticParameters &other = cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), NPROPS );
+    BOOST_TEST( ElasticParameters::parses == 2 );
+    BOOST_TEST( &other != &first );
+    CMNAME[ 5 ] = ' ';
+
+    //Changing the properties in place invalidates the lookup without invalidating older references
+    PROPS[ 0 ] = 100.e3;
+    const ElasticParameters &changed = cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), NPROPS );
+    BOOST_TEST( ElasticParameters::parses == 3 );
+    BOOST_TEST( changed.shear_modulus == 40.e3 );
+    BOOST_TEST( first.shear_modulus == 80.e3 );
+
+    //Invalid properties throw and are not cached
+    BOOST_CHECK_THROW( cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), 1 ), std::invalid_argument );
+    BOOST_TEST( cache.size( ) == 3 );
+
+    //Concurrent lookups of a new parameter set resolve to a single cached entry
+    PROPS[ 1 ] = 0.3;
+    std::vector< const ElasticParameters* > results( 8, nullptr );
+    std::vector< std::thread > threads;
+    for ( unsigned int thread = 0; thread < results.size( ); thread++ ){
+        threads.emplace_back( [ & ]( const unsigned int index ){
+                                  for ( unsigned int iteration = 0; iteration < 1000; iteration++ ){
+                                      results[ index ] = &cache.get( CMNAME.data( ), CMNAME_length, PROPS.data( ), NPROPS );
+                                  }
+                              }, thread );
+    }
+    for ( std::thread &thread : threads ){
+        thread.join( );
+    }
+    for ( const ElasticParameters *result : results ){
+        BOOST_TEST( result == results[ 0 ] );
+    }
+    BOOST_TEST( cache.size( ) == 4 );
+
+    cache.clear( );
+    BOOST_TEST( cache.size( ) == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( testContractFullNTENSMatrixExplicit ){
+    /*!
+     * Test the Abaqus/Explicit ordering of the full matrix contraction
+     */
+
+    std::vector< std::vector< int > > full_matrix( 9, std::vector< int >( 9 ) );
+    const std::vector< int > components = { 11, 12, 13, 21, 22, 23, 31, 32, 33 };
+    for ( unsigned int i = 0; i < 9; i++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
+            full_matrix[ i ][ j ] = 100 * components[ i ] + components[ j ];
+        }
+    }
+    std::vector< std::vector< int > > full_abaqus_explicit_matrix = { { 1111, 1122, 1133, 1112, 1123, 1113 },
+                                                                      { 2211, 2222, 2233, 2212, 2223, 2213 },
+                                                                      { 3311, 3322, 3333, 3312, 3323, 3313 },
+                                                                      { 1211, 1222, 1233, 1212, 1223, 1213 },
+                                                                      { 2311, 2322, 2333, 2312, 2323, 2313 },
+                                                                      { 1311, 1322, 1333, 1312, 1323, 1313 } };
+
+    std::vector< std::vector< int > > result = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, false );
+    BOOST_TEST( tardigradeVectorTools::appendVectors( result ) == tardigradeVectorTools::appendVectors( full_abaqus_explicit_matrix ),
+                boost::test_tools::per_element() );
+
+    result = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, 3, 3, false );
+    BOOST_TEST( tardigradeVectorTools::appendVectors( result ) == tardigradeVectorTools::appendVectors( full_abaqus_explicit_matrix ),
+                boost::test_tools::per_element() );
+
+}
+
+BOOST_AUTO_TEST_CASE( testFusedNTENSKernels ){
+    /*!
+     * Test that the fused pointer kernels agree with the std::vector reference path for both Abaqus solvers and every
+     * NDI and NSHR combination
+     */
+
+    std::vector< std::vector< double > > full_matrix( 9, std::vector< double >( 9 ) );
+    std::vector< double > full_matrix_array( 81 );
+    for ( unsigned int i = 0; i < 9; i++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
+            full_matrix[ i ][ j ] = 10. * i + j + 1.;
+            full_matrix_array[ 9 * i + j ] = full_matrix[ i ][ j ];
+        }
+    }
+    const std::vector< double > full_tensor = { 11, 12, 13,
+                                                12, 22, 23,
+                                                13, 23, 33 };
+
+    for ( const bool abaqus_standard : { true, false } ){
+        for ( int NDI = 1; NDI <= 3; NDI++ ){
+            for ( int NSHR = 0; NSHR <= 3; NSHR++ ){
+                const int NTENS = NDI + NSHR;
+                std::vector< double > abaqus_vector( NTENS );
+                for ( int index = 0; index < NTENS; index++ ){
+                    abaqus_vector[ index ] = index + 1.;
+                }
+
+                //Tensor expansion
+                std::vector< double > expected_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard );
+                std::vector< double > fused_tensor( 9, -666. );
+                tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector.data( ), NDI, NSHR, fused_tensor.data( ), abaqus_standard );
+                BOOST_TEST( fused_tensor == expected_tensor, boost::test_tools::per_element() );
+
+                //Tensor contraction
+                std::vector< double > expected_vector = tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard );
+                std::vector< double > fused_vector( NTENS, -666. );
+                tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor.data( ), NDI, NSHR, fused_vector.data( ), abaqus_standard );
+                BOOST_TEST( fused_vector == expected_vector, boost::test_tools::per_element() );
+
+                //Matrix contraction directly into a column-major DDSDDE
+                std::vector< std::vector< double > > expected_matrix = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, NDI, NSHR, abaqus_standard );
+                std::vector< double > expected_ddsdde( NTENS * NTENS );
+                tardigradeAbaqusTools::rowToColumnMajor( expected_ddsdde.data( ), expected_matrix, NTENS, NTENS );
+                std::vector< double > fused_ddsdde( NTENS * NTENS, -666. );
+                tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix_array.data( ), NDI, NSHR, fused_ddsdde.data( ), abaqus_standard );
+                BOOST_TEST( fused_ddsdde == expected_ddsdde, boost::test_tools::per_element() );
+            }
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testBuildModeChecks ){
+    /*!
+     * Test the NDI/NSHR range, size, and NaN/Inf checks of the checked build mode
+     */
+
+    std::vector< double > abaqus_vector = { 1, 2, 3, 4 };
+    std::vector< double > full_tensor = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_CHECKED
+    //NDI and NSHR ranges
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, 4, 0 ), std::out_of_range );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, 3, -1 ), std::out_of_range );
+
+    //Container sizes
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, 3, 0 ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, 3, 3 ), std::length_error );
+
+#endif
+
+#if defined( TARDIGRADE_ABAQUS_TOOLS_CHECKED ) && defined( TARDIGRADE_ABAQUS_TOOLS_CHECKED_FINITE )
+    //NaN and Inf values with the element and integration point context
+    std::vector< double > bad_tensor = full_tensor;
+    bad_tensor[ 4 ] = std::nan( "" );
+    {
+        tardigradeAbaqusTools::CheckContextScope context( 12, 3 );
+        try{
+            tardigradeAbaqusTools::contractFullNTENSTensor( bad_tensor, 3, 3 );
+            BOOST_FAIL( "NaN value was not detected" );
+        }
+        catch( const std::domain_error &error ){
+            const std::string message = error.what( );
+            BOOST_TEST( message.find( "full_tensor[4]" ) != std::string::npos );
+            BOOST_TEST( message.find( "element 12, integration point 3" ) != std::string::npos );
+        }
+    }
+    BOOST_TEST( tardigradeAbaqusTools::checkContext( ).NOEL == 0 );
+    bad_tensor[ 4 ] = INFINITY;
+    double fused_vector[ 6 ];
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::contractFullNTENSTensor( bad_tensor.data( ), 3, 3, fused_vector ),
+                       std::domain_error );
+
+    //A singular stretch produces a non-finite rotation
+    const double stretch[ 6 ] = { 0, 1, 1, 0, 0, 0 };
+    const double defgrad[ 9 ] = { 0, 1, 1, 0, 0, 0, 0, 0, 0 };
+    double rotation[ 9 ];
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::computeVUMATRotationBlock( 1, 3, 3, stretch, defgrad, rotation ),
+                       std::domain_error );
+#endif
+
+    //Valid arguments never throw in either build mode
+    BOOST_CHECK_NO_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, 3, 1 ) );
+    BOOST_CHECK_NO_THROW( tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, 2, 1 ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testSnapshotColumnEncoding ){
+    /*!
+     * Test the bit exact round trip of the XOR-delta snapshot column compression
+     */
+
+    const std::vector< double > values = { 0, 0, 1.5, 1.5, -2.25e10, std::nan( "" ), INFINITY, -0., 1e-300, 1e-300 };
+    std::vector< unsigned char > bytes;
+    tardigradeAbaqusTools::encodeSnapshotColumn( values.data( ), values.size( ), bytes );
+    BOOST_TEST( bytes.size( ) < values.size( ) * sizeof( double ) );
+
+    std::vector< double > decoded( values.size( ) );
+    BOOST_TEST( tardigradeAbaqusTools::decodeSnapshotColumn( bytes.data( ), bytes.size( ), decoded.data( ), decoded.size( ) ) == bytes.size( ) );
+    BOOST_TEST( std::memcmp( decoded.data( ), values.data( ), values.size( ) * sizeof( double ) ) == 0 );
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::decodeSnapshotColumn( bytes.data( ), bytes.size( ) - 1, decoded.data( ), decoded.size( ) ),
+                       std::runtime_error );
+
+}
+
+struct TemporarySnapshotFile{
+    /*!
+     * A unique snapshot file name in the temporary directory. The file is removed on destruction.
+     */
+
+    explicit TemporarySnapshotFile( const std::string &name ){
+        /*!
+         * \param &name: The file name stem
+         */
+        const std::string suffix = std::to_string( std::random_device( )( ) ) + "_"
+                                 + std::to_string( std::chrono::steady_clock::now( ).time_since_epoch( ).count( ) );
+        path = ( std::filesystem::temp_directory_path( ) / ( "tardigrade_abaqus_tools_" + name + "_" + suffix + ".bin" ) ).string( );
+    }
+
+    ~TemporarySnapshotFile( ){
+        std::error_code error;
+        std::filesystem::remove( path, error );
+    }
+
+    std::string path;
+};
+
+BOOST_AUTO_TEST_CASE( testSnapshotWriter ){
+    /*!
+     * Test concurrent snapshot submission and the columnar snapshot file
+     */
+
+    const int NTENS = 4;
+    const int NSTATV = 3;
+    const int threads = 4;
+    const int points = 2000;
+
+    for ( const bool compress : { false, true } ){
+        const TemporarySnapshotFile file( compress ? "test_snapshot_compressed" : "test_snapshot" );
+        const std::string &filename = file.path;
+        tardigradeAbaqusTools::SnapshotStatistics statistics;
+        {
+            //A small queue and batch exercise the blocking back-pressure and the batch boundaries
+            tardigradeAbaqusTools::SnapshotWriter writer( filename, NTENS, NSTATV, 64, 50,
+                                                          tardigradeAbaqusTools::SnapshotBackPressure::BLOCK, compress );
+            BOOST_TEST( writer.capacity( ) == 64 );
+            std::vector< std::thread > workers;
+            for ( int thread = 0; thread < threads; thread++ ){
+                workers.emplace_back( [ &writer, thread ]( ){
+                    for ( int point = thread; point < points; point += threads ){
+                        const double STRESS[ NTENS ] = { 1. * point, 2. * point, 3. * point, 0.5 };
+                        const double STATEV[ NSTATV ] = { 0., -1. * point, 7. };
+                        writer.submit( point, 1 + point % 8, 1, 2, 0.25, STRESS, STATEV );
+                    }
+                } );
+            }
+            for ( std::thread &worker : workers ){
+                worker.join( );
+            }
+            writer.flush( );
+            statistics = writer.statistics( );
+            BOOST_TEST( statistics.written == static_cast< std::uint64_t >( points ) );
+            writer.close( );
+        }
+        BOOST_TEST( statistics.submitted == static_cast< std::uint64_t >( points ) );
+        BOOST_TEST( statistics.dropped == 0u );
+
+        const tardigradeAbaqusTools::SnapshotColumns columns = tardigradeAbaqusTools::readSnapshotFile( filename );
+        BOOST_TEST( columns.NTENS == NTENS );
+        BOOST_TEST( columns.NSTATV == NSTATV );
+        BOOST_TEST( columns.NOEL.size( ) == static_cast< std::size_t >( points ) );
+        BOOST_TEST( columns.stress.size( ) == static_cast< std::size_t >( NTENS ) );
+        BOOST_TEST( columns.statev.size( ) == static_cast< std::size_t >( NSTATV ) );
+        std::vector< bool > found( points, false );
+        for ( std::size_t row = 0; row < columns.NOEL.size( ); row++ ){
+            const int point = columns.NOEL[ row ];
+            found[ point ] = true;
+            BOOST_TEST( columns.NPT[ row ] == 1 + point % 8 );
+            BOOST_TEST( columns.KSTEP[ row ] == 1 );
+            BOOST_TEST( columns.KINC[ row ] == 2 );
+            BOOST_TEST( columns.time[ row ] == 0.25 );
+            BOOST_TEST( columns.stress[ 2 ][ row ] == 3. * point );
+            BOOST_TEST( columns.stress[ 3 ][ row ] == 0.5 );
+            BOOST_TEST( columns.statev[ 1 ][ row ] == -1. * point );
+            BOOST_TEST( columns.statev[ 2 ][ row ] == 7. );
+        }
+        BOOST_TEST( ( std::find( found.begin( ), found.end( ), false ) == found.end( ) ) );
+    }
+
+    //The DROP policy accounts for every submitted snapshot
+    const TemporarySnapshotFile drop_file( "test_snapshot_drop" );
+    tardigradeAbaqusTools::SnapshotWriter writer( drop_file.path, 1, 0, 2, 1,
+                                                  tardigradeAbaqusTools::SnapshotBackPressure::DROP );
+    unsigned int queued = 0;
+    for ( int point = 0; point < 1000; point++ ){
+        const double STRESS[ 1 ] = { 1. };
+        const double STATEV[ 1 ] = { 0. };
+        queued += writer.submit( point, 1, 1, 1, 0., STRESS, STATEV );
+    }
+    writer.close( );
+    const tardigradeAbaqusTools::SnapshotStatistics statistics = writer.statistics( );
+    BOOST_TEST( statistics.submitted == queued );
+    BOOST_TEST( statistics.submitted + statistics.dropped == 1000u );
+    BOOST_TEST( statistics.written == statistics.submitted );
+    BOOST_TEST( tardigradeAbaqusTools::readSnapshotFile( drop_file.path ).NOEL.size( ) == queued );
+
+    //A submit that never waits for the writer is timed. The submit cost is measured by the performance suite.
+    const TemporarySnapshotFile overhead_file( "test_snapshot_overhead" );
+    {
+        tardigradeAbaqusTools::SnapshotWriter overhead_writer( overhead_file.path, NTENS, NSTATV, points, 256 );
+        for ( int point = 0; point < points; point++ ){
+            const double STRESS[ NTENS ] = { 1. * point, 2., 3., 4. };
+            const double STATEV[ NSTATV ] = { 5., 6., 7. };
+            overhead_writer.submit( point, 1, 1, 1, 0., STRESS, STATEV );
+        }
+        overhead_writer.close( );
+        const tardigradeAbaqusTools::SnapshotStatistics overhead = overhead_writer.statistics( );
+        BOOST_TEST( overhead.blocked == 0u );
+        BOOST_TEST( overhead.meanSubmitNanoseconds( ) > 0. );
+    }
+
+    //Closing without a flush writes every queued snapshot
+    const TemporarySnapshotFile close_file( "test_snapshot_close" );
+    for ( const bool destroy : { false, true } ){
+        {
+            tardigradeAbaqusTools::SnapshotWriter close_writer( close_file.path, NTENS, NSTATV, 16, 4 );
+            for ( int point = 0; point < 100; point++ ){
+                const double STRESS[ NTENS ] = { 1. * point, 2., 3., 4. };
+                const double STATEV[ NSTATV ] = { 5., 6., 7. };
+                close_writer.submit( point, 1, 1, 1, 0., STRESS, STATEV );
+            }
+            if ( !destroy ){
+                close_writer.close( );
+            }
+        }
+        const tardigradeAbaqusTools::SnapshotColumns columns = tardigradeAbaqusTools::readSnapshotFile( close_file.path );
+        BOOST_TEST( columns.NOEL.size( ) == 100u );
+        BOOST_TEST( columns.stress[ 0 ].back( ) == 99. );
+    }
+
+#ifdef __linux__
+    //Writer thread I/O errors are thrown by flush, submit, and close
+    if ( std::filesystem::exists( "/dev/full" ) ){
+        tardigradeAbaqusTools::SnapshotWriter full_writer( "/dev/full", NTENS, NSTATV );
+        const double STRESS[ NTENS ] = { 1., 2., 3., 4. };
+        const double STATEV[ NSTATV ] = { 5., 6., 7. };
+        BOOST_TEST( full_writer.submit( 1, 1, 1, 1, 0., STRESS, STATEV ) );
+        BOOST_CHECK_THROW( full_writer.flush( ), std::runtime_error );
+        BOOST_CHECK_THROW( full_writer.submit( 2, 1, 1, 1, 0., STRESS, STATEV ), std::runtime_error );
+        BOOST_CHECK_THROW( full_writer.close( ), std::runtime_error );
+    }
+#endif
+
+}
+
+BOOST_AUTO_TEST_CASE( testSoAPackUnpack ){
+    /*!
+     * Test the packing of Abaqus block and point arrays into aligned SoA buffers
+     */
+
+    const int nblock = 13;
+    tardigradeAbaqusTools::SoABuffer< double > soa( 6, nblock );
+    BOOST_TEST( soa.stride( ) % tardigradeAbaqusTools::SoABuffer< double >::lanes == 0 );
+    BOOST_TEST( soa.stride( ) >= nblock );
+    BOOST_TEST( reinterpret_cast< std::uintptr_t >( soa.data( ) ) % 64 == 0u );
+
+    for ( const bool abaqus_standard : { true, false } ){
+        for ( int NDI = 1; NDI <= 3; NDI++ ){
+            for ( int NSHR = 0; NSHR <= 3; NSHR++ ){
+                const int NTENS = NDI + NSHR;
+                std::vector< double > block( nblock * NTENS );
+                for ( int component = 0; component < NTENS; component++ ){
+                    for ( int point = 0; point < nblock; point++ ){
+                        block[ component * nblock + point ] = 100. * ( component + 1 ) + point;
+                    }
+                }
+
+                //Every lane holds the full length 6 Abaqus vector of the point
+                tardigradeAbaqusTools::packNTENSBlock( nblock, NDI, NSHR, block.data( ), soa, abaqus_standard );
+                tardigradeAbaqusTools::SoABuffer< double > point_soa( 6, nblock );
+                for ( int point = 0; point < nblock; point++ ){
+                    std::vector< double > abaqus_vector( NTENS );
+                    for ( int component = 0; component < NTENS; component++ ){
+                        abaqus_vector[ component ] = block[ component * nblock + point ];
+                    }
+                    std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard );
+                    std::vector< double > expected = tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, 3, 3, abaqus_standard );
+                    tardigradeAbaqusTools::packNTENSPoint( abaqus_vector.data( ), NDI, NSHR, point, point_soa, abaqus_standard );
+                    for ( int component = 0; component < 6; component++ ){
+                        BOOST_TEST( soa.component( component )[ point ] == expected[ component ] );
+                        BOOST_TEST( point_soa.component( component )[ point ] == expected[ component ] );
+                    }
+
+                    std::vector< double > unpacked( NTENS, -666. );
+                    tardigradeAbaqusTools::unpackNTENSPoint( soa, point, NDI, NSHR, unpacked.data( ), abaqus_standard );
+                    BOOST_TEST( unpacked == abaqus_vector, boost::test_tools::per_element() );
+                }
+
+                //Padded lanes repeat the last point
+                for ( int component = 0; component < 6; component++ ){
+                    for ( int lane = nblock; lane < soa.stride( ); lane++ ){
+                        BOOST_TEST( soa.component( component )[ lane ] == soa.component( component )[ nblock - 1 ] );
+                    }
+                }
+
+                std::vector< double > unpacked( nblock * NTENS, -666. );
+                tardigradeAbaqusTools::unpackNTENSBlock( soa, nblock, NDI, NSHR, unpacked.data( ), abaqus_standard );
+                BOOST_TEST( unpacked == block, boost::test_tools::per_element() );
+            }
+        }
+    }
+
+    //Deformation gradient blocks in the Abaqus/Explicit component order
+    const int defgrad_tensor_index[ 2 ][ 9 ] = { { 0, 4, 8, 1, 3 }, { 0, 4, 8, 1, 5, 6, 3, 7, 2 } };
+    for ( const int nshr : { 1, 3 } ){
+        const int components = 3 + 2 * nshr;
+        std::vector< double > defgrad( nblock * components );
+        for ( int component = 0; component < components; component++ ){
+            for ( int point = 0; point < nblock; point++ ){
+                defgrad[ component * nblock + point ] = 10. * ( component + 2 ) + point;
+            }
+        }
+        tardigradeAbaqusTools::SoABuffer< double > defgrad_soa;
+        tardigradeAbaqusTools::packVUMATDeformationGradient( nblock, 3, nshr, defgrad.data( ), defgrad_soa );
+        BOOST_TEST( defgrad_soa.components( ) == 9 );
+        for ( int point = 0; point < nblock; point++ ){
+            std::vector< double > expected = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+            for ( int component = 0; component < components; component++ ){
+                expected[ defgrad_tensor_index[ nshr == 3 ][ component ] ] = defgrad[ component * nblock + point ];
+            }
+            for ( int index = 0; index < 9; index++ ){
+                BOOST_TEST( defgrad_soa.component( index )[ point ] == expected[ index ] );
+            }
+        }
+    }
+
+    //State variable blocks
+    const int nstatev = 5;
+    std::vector< double > state( nblock * nstatev );
+    for ( unsigned int index = 0; index < state.size( ); index++ ){
+        state[ index ] = 0.5 * index;
+    }
+    tardigradeAbaqusTools::SoABuffer< double > state_soa;
+    tardigradeAbaqusTools::packStateBlock( nblock, nstatev, state.data( ), state_soa );
+    BOOST_TEST( state_soa.component( 3 )[ 7 ] == state[ 3 * nblock + 7 ] );
+    std::vector< double > unpacked_state( nblock * nstatev, -666. );
+    tardigradeAbaqusTools::unpackStateBlock( state_soa, nblock, nstatev, unpacked_state.data( ) );
+    BOOST_TEST( unpacked_state == state, boost::test_tools::per_element() );
+
+    //UMAT state variables and deformation gradients packed one point at a time
+    tardigradeAbaqusTools::SoABuffer< double > statev_soa( nstatev, nblock );
+    tardigradeAbaqusTools::SoABuffer< double > dfgrd_soa( 9, nblock );
+    for ( int point = 0; point < nblock; point++ ){
+        std::vector< double > STATEV( nstatev );
+        std::vector< double > DFGRD( 9 );
+        for ( int index = 0; index < nstatev; index++ ){
+            STATEV[ index ] = state[ index * nblock + point ];
+        }
+        for ( int index = 0; index < 9; index++ ){
+            DFGRD[ index ] = 1. + 0.1 * index + 0.01 * point;
+        }
+        tardigradeAbaqusTools::packStatePoint( STATEV.data( ), nstatev, point, statev_soa );
+        tardigradeAbaqusTools::packUMATDeformationGradientPoint( DFGRD.data( ), point, dfgrd_soa );
+
+        //The SoA rows are the row-major tensor of the column-major DFGRD
+        for ( int row = 0; row < 3; row++ ){
+            for ( int col = 0; col < 3; col++ ){
+                BOOST_TEST( dfgrd_soa.component( 3 * row + col )[ point ] == DFGRD[ row + 3 * col ] );
+            }
+        }
+
+        std::vector< double > unpacked_statev( nstatev, -666. );
+        std::vector< double > unpacked_dfgrd( 9, -666. );
+        tardigradeAbaqusTools::unpackStatePoint( statev_soa, point, nstatev, unpacked_statev.data( ) );
+        tardigradeAbaqusTools::unpackUMATDeformationGradientPoint( dfgrd_soa, point, unpacked_dfgrd.data( ) );
+        BOOST_TEST( unpacked_statev == STATEV, boost::test_tools::per_element() );
+        BOOST_TEST( unpacked_dfgrd == DFGRD, boost::test_tools::per_element() );
+    }
+    statev_soa.padLanes( );
+    for ( int index = 0; index < nstatev; index++ ){
+        for ( int point = 0; point < nblock; point++ ){
+            BOOST_TEST( statev_soa.component( index )[ point ] == state_soa.component( index )[ point ] );
+        }
+    }
+
+}